@@ -128,6 +128,16 @@ Value DecodeRawTransaction(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::DecodeRawTransaction);
 }
 
+/**
+ * @brief NodeAddon's JSON API for GetLockingScriptCacheInfo.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value GetLockingScriptCacheInfo(const CallbackInfo &information) {
+  return NodeAddonJsonResponseApi(
+      information, JsonMappingApi::GetLockingScriptCacheInfo);
+}
+
 /**
  * @brief NodeAddon's JSON API for ConvertEntropyToMnemonic.
  * @param[in] information     node addon api callback information
@@ -230,6 +240,15 @@ Value GetSighash(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::GetSighash);
 }
 
+/**
+ * @brief NodeAddon's JSON API for GetSighashes.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value GetSighashes(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::GetSighashes);
+}
+
 /**
  * @brief NodeAddon's JSON API.
  * @param[in] information     node addon api callback information
@@ -666,6 +685,15 @@ Value EstimateFee(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::EstimateFee);
 }
 
+/**
+ * @brief NodeAddon's JSON API for EstimateTransactionSize.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value EstimateTransactionSize(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::EstimateTransactionSize);
+}
+
 /**
  * @brief NodeAddon's JSON API.
  * @param[in] information     node addon api callback information
@@ -675,6 +703,24 @@ Value SelectUtxos(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::SelectUtxos);
 }
 
+/**
+ * @brief NodeAddon's JSON API for SelectUtxosBatch.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value SelectUtxosBatch(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::SelectUtxosBatch);
+}
+
+/**
+ * @brief NodeAddon's JSON API for ReselectUtxos.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value ReselectUtxos(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::ReselectUtxos);
+}
+
 /**
  * @brief NodeAddon's JSON API.
  * @param[in] information     node addon api callback information
@@ -684,6 +730,51 @@ Value FundRawTransaction(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::FundRawTransaction);
 }
 
+/**
+ * @brief NodeAddon's JSON API for CreateUtxoPool.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value CreateUtxoPool(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::CreateUtxoPool);
+}
+
+/**
+ * @brief NodeAddon's JSON API for AddUtxoPoolItems.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value AddUtxoPoolItems(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::AddUtxoPoolItems);
+}
+
+/**
+ * @brief NodeAddon's JSON API for RemoveUtxoPoolItems.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value RemoveUtxoPoolItems(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::RemoveUtxoPoolItems);
+}
+
+/**
+ * @brief NodeAddon's JSON API for LockUtxoPoolItems.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value LockUtxoPoolItems(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::LockUtxoPoolItems);
+}
+
+/**
+ * @brief NodeAddon's JSON API for DeleteUtxoPool.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value DeleteUtxoPool(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::DeleteUtxoPool);
+}
+
 /**
  * @brief NodeAddon's JSON API.
  * @param[in] information     node addon api callback information
@@ -702,6 +793,15 @@ Value SplitTxOut(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::SplitTxOut);
 }
 
+/**
+ * @brief NodeAddon's JSON API for EditRawTransaction.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value EditRawTransaction(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::EditRawTransaction);
+}
+
 /**
  * @brief Implements get txin index api for JSON.
  * @param[in] information     JSON data.
@@ -1139,6 +1239,15 @@ Value SetRawReissueAsset(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::SetRawReissueAsset);
 }
 
+/**
+ * @brief NodeAddon's JSON API for SetRawIssuanceBatch.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value SetRawIssuanceBatch(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::SetRawIssuanceBatch);
+}
+
 /**
  * @brief NodeAddon's JSON API.
  * @param[in] information     node addon api callback information
@@ -1158,6 +1267,15 @@ Value CreateRawPegin(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::CreateRawPegin);
 }
 
+/**
+ * @brief NodeAddon's JSON API for CreateRawPeginBatch.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value CreateRawPeginBatch(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::CreateRawPeginBatch);
+}
+
 /**
  * @brief NodeAddon's JSON API.
  * @param[in] information     node addon api callback information
@@ -1195,6 +1313,16 @@ Value GetDefaultBlindingKey(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::GetDefaultBlindingKey);
 }
 
+/**
+ * @brief NodeAddon's JSON API for GetDefaultBlindingKeyBatch.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value GetDefaultBlindingKeyBatch(const CallbackInfo &information) {
+  return NodeAddonJsonApi(
+      information, JsonMappingApi::GetDefaultBlindingKeyBatch);
+}
+
 /**
  * @brief NodeAddon's JSON API.
  * @param[in] information     node addon api callback information
@@ -1222,6 +1350,24 @@ Value GetCommitment(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::GetCommitment);
 }
 
+/**
+ * @brief NodeAddon's JSON API for GetCommitments.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value GetCommitments(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::GetCommitments);
+}
+
+/**
+ * @brief NodeAddon's JSON API for EstimateBlindProofSize.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value EstimateBlindProofSize(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::EstimateBlindProofSize);
+}
+
 /**
  * @brief NodeAddon's JSON API.
  * @param[in] information     node addon api callback information
@@ -1230,6 +1376,15 @@ Value GetCommitment(const CallbackInfo &information) {
 Value GetUnblindData(const CallbackInfo &information) {
   return NodeAddonJsonApi(information, JsonMappingApi::GetUnblindData);
 }
+
+/**
+ * @brief NodeAddon's JSON API for ScanAndUnblind.
+ * @param[in] information     node addon api callback information
+ * @return json string.
+ */
+Value ScanAndUnblind(const CallbackInfo &information) {
+  return NodeAddonJsonApi(information, JsonMappingApi::ScanAndUnblind);
+}
 #endif  // CFD_DISABLE_ELEMENTS
 
 /**
@@ -1252,6 +1407,9 @@ void InitializeJsonApi(Env env, Object *exports) {
   exports->Set(
       String::New(env, "DecodeRawTransaction"),
       Function::New(env, DecodeRawTransaction));
+  exports->Set(
+      String::New(env, "GetLockingScriptCacheInfo"),
+      Function::New(env, GetLockingScriptCacheInfo));
   exports->Set(
       String::New(env, "ConvertEntropyToMnemonic"),
       Function::New(env, ConvertEntropyToMnemonic));
@@ -1280,6 +1438,9 @@ void InitializeJsonApi(Env env, Object *exports) {
       String::New(env, "CreateSignatureHash"),
       Function::New(env, CreateSignatureHash));
   exports->Set(String::New(env, "GetSighash"), Function::New(env, GetSighash));
+  exports->Set(
+      String::New(env, "GetSighashes"),
+      Function::New(env, GetSighashes));
   exports->Set(String::New(env, "ConvertAes"), Function::New(env, ConvertAes));
   exports->Set(
       String::New(env, "EncodeBase58"), Function::New(env, EncodeBase58));
@@ -1401,15 +1562,42 @@ void InitializeJsonApi(Env env, Object *exports) {
       Function::New(env, CalculateEcSignature));
   exports->Set(
       String::New(env, "EstimateFee"), Function::New(env, EstimateFee));
+  exports->Set(
+      String::New(env, "EstimateTransactionSize"),
+      Function::New(env, EstimateTransactionSize));
   exports->Set(
       String::New(env, "SelectUtxos"), Function::New(env, SelectUtxos));
+  exports->Set(
+      String::New(env, "SelectUtxosBatch"),
+      Function::New(env, SelectUtxosBatch));
+  exports->Set(
+      String::New(env, "ReselectUtxos"),
+      Function::New(env, ReselectUtxos));
   exports->Set(
       String::New(env, "FundRawTransaction"),
       Function::New(env, FundRawTransaction));
+  exports->Set(
+      String::New(env, "CreateUtxoPool"),
+      Function::New(env, CreateUtxoPool));
+  exports->Set(
+      String::New(env, "AddUtxoPoolItems"),
+      Function::New(env, AddUtxoPoolItems));
+  exports->Set(
+      String::New(env, "RemoveUtxoPoolItems"),
+      Function::New(env, RemoveUtxoPoolItems));
+  exports->Set(
+      String::New(env, "LockUtxoPoolItems"),
+      Function::New(env, LockUtxoPoolItems));
+  exports->Set(
+      String::New(env, "DeleteUtxoPool"),
+      Function::New(env, DeleteUtxoPool));
   exports->Set(
       String::New(env, "UpdateTxOutAmount"),
       Function::New(env, UpdateTxOutAmount));
   exports->Set(String::New(env, "SplitTxOut"), Function::New(env, SplitTxOut));
+  exports->Set(
+      String::New(env, "EditRawTransaction"),
+      Function::New(env, EditRawTransaction));
   exports->Set(
       String::New(env, "GetTxInIndex"), Function::New(env, GetTxInIndex));
   exports->Set(
@@ -1529,11 +1717,17 @@ void InitializeJsonApi(Env env, Object *exports) {
   exports->Set(
       String::New(env, "SetRawReissueAsset"),
       Function::New(env, SetRawReissueAsset));
+  exports->Set(
+      String::New(env, "SetRawIssuanceBatch"),
+      Function::New(env, SetRawIssuanceBatch));
   exports->Set(
       String::New(env, "CreateElementsSignatureHash"),
       Function::New(env, CreateElementsSignatureHash));
   exports->Set(
       String::New(env, "CreateRawPegin"), Function::New(env, CreateRawPegin));
+  exports->Set(
+      String::New(env, "CreateRawPeginBatch"),
+      Function::New(env, CreateRawPeginBatch));
   exports->Set(
       String::New(env, "UpdatePeginWitnessStack"),
       Function::New(env, UpdatePeginWitnessStack));
@@ -1546,6 +1740,9 @@ void InitializeJsonApi(Env env, Object *exports) {
   exports->Set(
       String::New(env, "GetDefaultBlindingKey"),
       Function::New(env, GetDefaultBlindingKey));
+  exports->Set(
+      String::New(env, "GetDefaultBlindingKeyBatch"),
+      Function::New(env, GetDefaultBlindingKeyBatch));
   exports->Set(
       String::New(env, "CreateDestroyAmount"),
       Function::New(env, CreateDestroyAmount));
@@ -1554,8 +1751,15 @@ void InitializeJsonApi(Env env, Object *exports) {
       Function::New(env, SerializeLedgerFormat));
   exports->Set(
       String::New(env, "GetCommitment"), Function::New(env, GetCommitment));
+  exports->Set(
+      String::New(env, "GetCommitments"), Function::New(env, GetCommitments));
+  exports->Set(
+      String::New(env, "EstimateBlindProofSize"),
+      Function::New(env, EstimateBlindProofSize));
   exports->Set(
       String::New(env, "GetUnblindData"), Function::New(env, GetUnblindData));
+  exports->Set(
+      String::New(env, "ScanAndUnblind"), Function::New(env, ScanAndUnblind));
 #endif  // CFD_DISABLE_ELEMENTS
 }
 
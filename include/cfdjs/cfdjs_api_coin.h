@@ -0,0 +1,77 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_api_coin.h
+ *
+ * @brief Definition of the coin (utxo pool) api class.
+ */
+#ifndef CFD_JS_INCLUDE_CFDJS_CFDJS_API_COIN_H_
+#define CFD_JS_INCLUDE_CFDJS_CFDJS_API_COIN_H_
+
+#include <string>
+
+#include "cfdjs/cfdjs_api_common.h"
+#include "cfdjs/cfdjs_struct.h"
+
+/**
+ * @brief cfdapi名前空間
+ */
+namespace cfd {
+namespace js {
+namespace api {
+
+/**
+ * @brief Coin api class.
+ * @details A utxo pool keeps pre-parsed utxos in native memory, and
+ *     SelectUtxos and FundRawTransaction refer to it by utxoPoolId.
+ */
+class CFD_JS_API_EXPORT CoinStructApi {
+ public:
+  /**
+   * @brief Create a utxo pool.
+   * @param[in] request   request struct from json
+   * @return response struct including the pool id.
+   */
+  static UtxoPoolInfoResponseStruct CreateUtxoPool(
+      const CreateUtxoPoolRequestStruct &request);
+
+  /**
+   * @brief Add utxos to the utxo pool.
+   * @param[in] request   request struct from json
+   * @return response struct including the pool information.
+   */
+  static UtxoPoolInfoResponseStruct AddUtxoPoolItems(
+      const AddUtxoPoolItemsRequestStruct &request);
+
+  /**
+   * @brief Remove utxos from the utxo pool.
+   * @param[in] request   request struct from json
+   * @return response struct including the pool information.
+   */
+  static UtxoPoolInfoResponseStruct RemoveUtxoPoolItems(
+      const RemoveUtxoPoolItemsRequestStruct &request);
+
+  /**
+   * @brief Lock or unlock utxos in the utxo pool.
+   * @param[in] request   request struct from json
+   * @return response struct including the pool information.
+   */
+  static UtxoPoolInfoResponseStruct LockUtxoPoolItems(
+      const LockUtxoPoolItemsRequestStruct &request);
+
+  /**
+   * @brief Delete the utxo pool.
+   * @param[in] request   request struct from json
+   * @return response struct including the last pool information.
+   */
+  static UtxoPoolInfoResponseStruct DeleteUtxoPool(
+      const DeleteUtxoPoolRequestStruct &request);
+
+ private:
+  CoinStructApi();
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_INCLUDE_CFDJS_CFDJS_API_COIN_H_
@@ -134,6 +134,15 @@ class CFD_JS_API_EXPORT ElementsTransactionStructApi {
   static CreateSignatureHashResponseStruct GetSighash(
       const GetSighashRequestStruct& request);
 
+  /**
+   * @brief Get the signature hashes of multiple txins.
+   * @details The transaction and utxos are parsed only once.
+   * @param[in] request   request struct from json
+   * @return response struct including the sighash list.
+   */
+  static GetSighashesResponseStruct GetSighashes(
+      const GetSighashesRequestStruct& request);
+
   /**
    * @brief Implements taproot sign api for JSON.
    * @param[in] request     request data.
@@ -231,6 +240,15 @@ class CFD_JS_API_EXPORT ElementsTransactionStructApi {
   static SetRawReissueAssetResponseStruct SetRawReissueAsset(
       const SetRawReissueAssetRequestStruct& request);
 
+  /**
+   * @brief Set issuances and reissuances to many transactions.
+   * @details Each transaction is processed concurrently.
+   * @param[in] request     request data.
+   * @return transaction and issuance data list.
+   */
+  static SetRawIssuanceBatchResponseStruct SetRawIssuanceBatch(
+      const SetRawIssuanceBatchRequestStruct& request);
+
   /**
    * @brief パラメータの情報を元に、Elements Pegin用のRaw Transactionを作成する.
    * @param[in] request Transactionを構築するパラメータの構造体
@@ -239,6 +257,16 @@ class CFD_JS_API_EXPORT ElementsTransactionStructApi {
   static RawTransactionResponseStruct CreateRawPeginTransaction(  // NOLINT
       const CreateRawPeginRequestStruct& request);
 
+  /**
+   * @brief Create many pegin transactions.
+   * @details Each distinct txoutproof and mainchain transaction is parsed
+   *     once, and every claim is checked against them.
+   * @param[in] request     request data.
+   * @return pegin transaction list.
+   */
+  static CreateRawPeginBatchResponseStruct CreateRawPeginTransactionBatch(
+      const CreateRawPeginBatchRequestStruct& request);
+
   /**
    * @brief Update pegin witness stack.
    * @param[in] request  pegin witness target data.
@@ -271,6 +299,14 @@ class CFD_JS_API_EXPORT ElementsTransactionStructApi {
   static BlindingKeyResponseStruct GetDefaultBlindingKey(
       const GetDefaultBlindingKeyRequestStruct& request);
 
+  /**
+   * @brief Get the default blinding keys of many locking scripts.
+   * @param[in] request     request data.
+   * @return blinding key list.
+   */
+  static GetDefaultBlindingKeyBatchResponseStruct GetDefaultBlindingKeyBatch(
+      const GetDefaultBlindingKeyBatchRequestStruct& request);
+
   /**
    * @brief パラメータの情報を元に、Elements DestroyAmount用のRaw Transactionを作成する.
    * @param[in] request Transactionを構築するパラメータの構造体
@@ -295,6 +331,25 @@ class CFD_JS_API_EXPORT ElementsTransactionStructApi {
   static GetCommitmentResponseStruct GetCommitment(
       const GetCommitmentRequestStruct& request);
 
+  /**
+   * @brief Get many commitments.
+   * @details The asset generators are taken from the process-wide cache.
+   * @param[in] request     request data.
+   * @return commitment list.
+   */
+  static GetCommitmentsResponseStruct GetCommitments(
+      const GetCommitmentsRequestStruct& request);
+
+  /**
+   * @brief Estimate the proof sizes of blinded outputs.
+   * @details The sizes are computed in closed form, so no sample proof is
+   *     generated.
+   * @param[in] request     request data.
+   * @return proof size list.
+   */
+  static EstimateBlindProofSizeResponseStruct EstimateBlindProofSize(
+      const EstimateBlindProofSizeRequestStruct& request);
+
   /**
    * @brief Get the unblind data.
    * @param[in] request     request data.
@@ -302,6 +357,16 @@ class CFD_JS_API_EXPORT ElementsTransactionStructApi {
    */
   static UnblindOutputStruct GetUnblindData(
       const GetUnblindDataRequestStruct& request);
+
+  /**
+   * @brief Scan transactions and unblind the outputs of the wallet scripts.
+   * @details Outputs of other scripts are not rewound. An output blinded
+   *     to another key is skipped.
+   * @param[in] request     request data.
+   * @return unblinded output list.
+   */
+  static ScanAndUnblindResponseStruct ScanAndUnblind(
+      const ScanAndUnblindRequestStruct& request);
 };
 
 }  // namespace api
@@ -73,6 +73,12 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string DecodeRawTransaction(const std::string &request_message);
 
+  /**
+   * @brief GetLockingScriptCacheInfo.
+   * @return json string
+   */
+  static std::string GetLockingScriptCacheInfo();
+
   /**
    * @brief ConvertEntropyToMnemonic.
    * @param[in] request_message     the request json message
@@ -153,6 +159,13 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string GetSighash(const std::string &request_message);
 
+  /**
+   * @brief GetSighashes.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string GetSighashes(const std::string &request_message);
+
   /**
    * @brief Convert data by AES.
    * @param[in] request_message   request json string.
@@ -494,6 +507,14 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string EstimateFee(const std::string &request_message);
 
+  /**
+   * @brief EstimateTransactionSize.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string EstimateTransactionSize(
+      const std::string &request_message);
+
   /**
    * @brief SelectUtxos.
    * @param[in] request_message     the request json message
@@ -501,6 +522,20 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string SelectUtxos(const std::string &request_message);
 
+  /**
+   * @brief SelectUtxosBatch.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string SelectUtxosBatch(const std::string &request_message);
+
+  /**
+   * @brief ReselectUtxos.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string ReselectUtxos(const std::string &request_message);
+
   /**
    * @brief FundRawTransaction.
    * @param[in] request_message     the request json message
@@ -508,6 +543,41 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string FundRawTransaction(const std::string &request_message);
 
+  /**
+   * @brief CreateUtxoPool.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string CreateUtxoPool(const std::string &request_message);
+
+  /**
+   * @brief AddUtxoPoolItems.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string AddUtxoPoolItems(const std::string &request_message);
+
+  /**
+   * @brief RemoveUtxoPoolItems.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string RemoveUtxoPoolItems(const std::string &request_message);
+
+  /**
+   * @brief LockUtxoPoolItems.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string LockUtxoPoolItems(const std::string &request_message);
+
+  /**
+   * @brief DeleteUtxoPool.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string DeleteUtxoPool(const std::string &request_message);
+
   /**
    * @brief UpdateTxOutAmount.
    * @param[in] request_message     the request json message
@@ -522,6 +592,13 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string SplitTxOut(const std::string &request_message);
 
+  /**
+   * @brief Apply multiple edit operations to the transaction.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string EditRawTransaction(const std::string &request_message);
+
   /**
    * @brief Get the transaction input index data.
    * @param[in] request_message     the request json message
@@ -871,6 +948,13 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string SetRawReissueAsset(const std::string &request_message);
 
+  /**
+   * @brief SetRawIssuanceBatch.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string SetRawIssuanceBatch(const std::string &request_message);
+
   /**
    * @brief CreateElementsSignatureHash.
    * @param[in] request_message     the request json message
@@ -886,6 +970,13 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string CreateRawPegin(const std::string &request_message);
 
+  /**
+   * @brief CreateRawPeginBatch.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string CreateRawPeginBatch(const std::string &request_message);
+
   /**
    * @brief UpdatePeginWitnessStack.
    * @param[in] request_message     the request json message
@@ -916,6 +1007,14 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string GetDefaultBlindingKey(const std::string &request_message);
 
+  /**
+   * @brief GetDefaultBlindingKeyBatch.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string GetDefaultBlindingKeyBatch(
+      const std::string &request_message);
+
   /**
    * @brief CreateDestroyAmount.
    * @param[in] request_message     the request json message
@@ -937,6 +1036,20 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string GetCommitment(const std::string &request_message);
 
+  /**
+   * @brief GetCommitments.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string GetCommitments(const std::string &request_message);
+
+  /**
+   * @brief EstimateBlindProofSize.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string EstimateBlindProofSize(const std::string &request_message);
+
   /**
    * @brief GetUnblindData.
    * @param[in] request_message     the request json message
@@ -944,6 +1057,13 @@ class CFD_JS_API_EXPORT JsonMappingApi {
    */
   static std::string GetUnblindData(const std::string &request_message);
 
+  /**
+   * @brief ScanAndUnblind.
+   * @param[in] request_message     the request json message
+   * @return json string
+   */
+  static std::string ScanAndUnblind(const std::string &request_message);
+
 #endif  // CFD_DISABLE_ELEMENTS
 
  private:
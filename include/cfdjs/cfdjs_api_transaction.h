@@ -20,6 +20,7 @@ namespace js {
 namespace api {
 
 using cfd::AddressFactory;
+using cfd::core::NetType;
 
 /**
  * @brief JSON struct api for bitcoin transaction.
@@ -135,6 +136,15 @@ class CFD_JS_API_EXPORT TransactionStructApi {
   static CreateSignatureHashResponseStruct GetSighash(
       const GetSighashRequestStruct& request);
 
+  /**
+   * @brief Get the signature hashes of multiple txins.
+   * @details The transaction and utxos are parsed only once.
+   * @param[in] request   request struct from json
+   * @return response struct including the sighash list.
+   */
+  static GetSighashesResponseStruct GetSighashes(
+      const GetSighashesRequestStruct& request);
+
   /**
    * @brief Implements taproot sign api for JSON.
    * @param[in] request     request data.
@@ -183,6 +193,26 @@ class CFD_JS_API_EXPORT TransactionStructApi {
   static RawTransactionResponseStruct SplitTxOut(
       const SplitTxOutRequestStruct& request);
 
+  /**
+   * @brief Apply multiple edit operations to the transaction.
+   * @details The transaction is parsed once, and serialized once after
+   *     all operations are applied.
+   * @param[in] request   transaction and edit operation list struct.
+   * @return transaction struct.
+   */
+  static RawTransactionResponseStruct EditRawTransaction(
+      const EditRawTransactionRequestStruct& request);
+
+  /**
+   * @brief Estimate the transaction size and fee by weight tables.
+   * @details No dummy signature is constructed, so many candidates can be
+   *     estimated in one call.
+   * @param[in] request   candidate transaction shape list struct.
+   * @return estimate result struct.
+   */
+  static EstimateTransactionSizeResponseStruct EstimateTransactionSize(
+      const EstimateTransactionSizeRequestStruct& request);
+
   /**
    * @brief Get the transaction input index data.
    * @param[in] request   getting txin index struct.
@@ -211,6 +241,25 @@ class CFD_JS_API_EXPORT TransactionStructApi {
       const AddressFactory& factory, const Script& script,
       std::string* script_type, int64_t* require_num);
 
+  /**
+   * @brief Convert from locking script, using the resolution cache.
+   * @details The result is cached by script bytes and network.
+   * @param[in] net_type    network type
+   * @param[in] script      locking script
+   * @param[out] script_type    script type
+   * @param[out] require_num    multisig require num
+   * @return address list
+   */
+  static std::vector<Address> ConvertFromLockingScript(
+      NetType net_type, const Script& script, std::string* script_type,
+      int64_t* require_num);
+
+  /**
+   * @brief Get the locking script resolution cache information.
+   * @return cache information struct.
+   */
+  static GetLockingScriptCacheInfoResponseStruct GetLockingScriptCacheInfo();
+
  private:
   TransactionStructApi();
 };
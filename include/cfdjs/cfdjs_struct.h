@@ -101,6 +101,22 @@ struct DecodeRawTransactionTxOutStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// ElementsAddPeginWitnessStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ElementsAddPeginWitnessStruct struct
+ */
+struct ElementsAddPeginWitnessStruct {
+  int64_t amount = 0;                             //!< amount  // NOLINT
+  std::string asset = "";                         //!< asset  // NOLINT
+  std::string mainchain_genesis_block_hash = "";  //!< mainchain_genesis_block_hash  // NOLINT
+  std::string claim_script = "";                  //!< claim_script  // NOLINT
+  std::string mainchain_raw_transaction = "";     //!< mainchain_raw_transaction  // NOLINT
+  std::string mainchain_txoutproof = "";          //!< mainchain_txoutproof  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // PsbtBip32PubkeyInputStruct
 // ------------------------------------------------------------------------
@@ -196,22 +212,6 @@ struct DescriptorKeyJsonStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
-// ------------------------------------------------------------------------
-// ElementsAddPeginWitnessStruct
-// ------------------------------------------------------------------------
-/**
- * @brief ElementsAddPeginWitnessStruct struct
- */
-struct ElementsAddPeginWitnessStruct {
-  int64_t amount = 0;                             //!< amount  // NOLINT
-  std::string asset = "";                         //!< asset  // NOLINT
-  std::string mainchain_genesis_block_hash = "";  //!< mainchain_genesis_block_hash  // NOLINT
-  std::string claim_script = "";                  //!< claim_script  // NOLINT
-  std::string mainchain_raw_transaction = "";     //!< mainchain_raw_transaction  // NOLINT
-  std::string mainchain_txoutproof = "";          //!< mainchain_txoutproof  // NOLINT
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
 // ------------------------------------------------------------------------
 // ElementsDecodeIssuanceStruct
 // ------------------------------------------------------------------------
@@ -255,6 +255,82 @@ struct ElementsDecodeLockingScriptStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// ElementsPeginTxInStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ElementsPeginTxInStruct struct
+ */
+struct ElementsPeginTxInStruct {
+  bool is_pegin = true;                         //!< is_pegin  // NOLINT
+  std::string txid = "";                        //!< txid  // NOLINT
+  uint32_t vout = 0;                            //!< vout  // NOLINT
+  uint32_t sequence = 4294967295;               //!< sequence  // NOLINT
+  ElementsAddPeginWitnessStruct peginwitness;   //!< peginwitness  // NOLINT
+  bool is_remove_mainchain_tx_witness = false;  //!< is_remove_mainchain_tx_witness  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// ElementsTxOutStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ElementsTxOutStruct struct
+ */
+struct ElementsTxOutStruct {
+  std::string address = "";                //!< address  // NOLINT
+  int64_t amount = 0;                      //!< amount  // NOLINT
+  std::string asset = "";                  //!< asset  // NOLINT
+  std::string direct_locking_script = "";  //!< direct_locking_script  // NOLINT
+  std::string direct_nonce = "";           //!< direct_nonce  // NOLINT
+  bool is_remove_nonce = false;            //!< is_remove_nonce  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// ElementsTxOutFeeStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ElementsTxOutFeeStruct struct
+ */
+struct ElementsTxOutFeeStruct {
+  int64_t amount = 0;      //!< amount  // NOLINT
+  std::string asset = "";  //!< asset  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// EstimateSizeInputDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EstimateSizeInputDataStruct struct
+ */
+struct EstimateSizeInputDataStruct {
+  std::string descriptor = "";      //!< descriptor  // NOLINT
+  std::string type = "";            //!< type  // NOLINT
+  uint32_t require_num = 1;         //!< require_num  // NOLINT
+  uint32_t pubkey_num = 1;          //!< pubkey_num  // NOLINT
+  uint32_t redeem_script_size = 0;  //!< redeem_script_size  // NOLINT
+  uint32_t tap_leaf_depth = 0;      //!< tap_leaf_depth  // NOLINT
+  uint32_t count = 1;               //!< count  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// EstimateSizeOutputDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EstimateSizeOutputDataStruct struct
+ */
+struct EstimateSizeOutputDataStruct {
+  std::string type = "";             //!< type  // NOLINT
+  uint32_t locking_script_size = 0;  //!< locking_script_size  // NOLINT
+  bool is_blind = false;             //!< is_blind  // NOLINT
+  int64_t amount = 0;                //!< amount  // NOLINT
+  uint32_t count = 1;                //!< count  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // HashKeyDataStruct
 // ------------------------------------------------------------------------
@@ -267,6 +343,40 @@ struct HashKeyDataStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// IssuanceDataRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief IssuanceDataRequestStruct struct
+ */
+struct IssuanceDataRequestStruct {
+  std::string txid = "";           //!< txid  // NOLINT
+  uint32_t vout = 0;               //!< vout  // NOLINT
+  int64_t asset_amount = 0;        //!< asset_amount  // NOLINT
+  std::string asset_address = "";  //!< asset_address  // NOLINT
+  int64_t token_amount = 0;        //!< token_amount  // NOLINT
+  std::string token_address = "";  //!< token_address  // NOLINT
+  bool is_blind = true;            //!< is_blind  // NOLINT
+  std::string contract_hash = "";  //!< contract_hash  // NOLINT
+  bool is_remove_nonce = false;    //!< is_remove_nonce  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// IssuanceDataResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief IssuanceDataResponseStruct struct
+ */
+struct IssuanceDataResponseStruct {
+  std::string txid = "";     //!< txid  // NOLINT
+  uint32_t vout = 0;         //!< vout  // NOLINT
+  std::string asset = "";    //!< asset  // NOLINT
+  std::string entropy = "";  //!< entropy  // NOLINT
+  std::string token = "";    //!< token  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // OutPointStruct
 // ------------------------------------------------------------------------
@@ -367,6 +477,23 @@ struct PubkeySignDataStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// ReissuanceDataRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ReissuanceDataRequestStruct struct
+ */
+struct ReissuanceDataRequestStruct {
+  std::string txid = "";                  //!< txid  // NOLINT
+  uint32_t vout = 0;                      //!< vout  // NOLINT
+  int64_t amount = 0;                     //!< amount  // NOLINT
+  std::string address = "";               //!< address  // NOLINT
+  std::string asset_blinding_nonce = "";  //!< asset_blinding_nonce  // NOLINT
+  std::string asset_entropy = "";         //!< asset_entropy  // NOLINT
+  bool is_remove_nonce = false;           //!< is_remove_nonce  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // SignDataStruct
 // ------------------------------------------------------------------------
@@ -383,6 +510,20 @@ struct SignDataStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// SplitTxOutDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SplitTxOutDataStruct struct
+ */
+struct SplitTxOutDataStruct {
+  int64_t amount = 0;                      //!< amount  // NOLINT
+  std::string address = "";                //!< address  // NOLINT
+  std::string direct_locking_script = "";  //!< direct_locking_script  // NOLINT
+  std::string direct_nonce = "";           //!< direct_nonce  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // TapScriptSignDataStruct
 // ------------------------------------------------------------------------
@@ -398,6 +539,18 @@ struct TapScriptSignDataStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// TargetAmountMapDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief TargetAmountMapDataStruct struct
+ */
+struct TargetAmountMapDataStruct {
+  std::string asset = "";  //!< asset  // NOLINT
+  int64_t amount = 0;      //!< amount  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // TxInRequestStruct
 // ------------------------------------------------------------------------
@@ -411,6 +564,36 @@ struct TxInRequestStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// UpdateTxOutAmountDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief UpdateTxOutAmountDataStruct struct
+ */
+struct UpdateTxOutAmountDataStruct {
+  int64_t amount = 0;                      //!< amount  // NOLINT
+  uint32_t index = 0;                      //!< index  // NOLINT
+  std::string address = "";                //!< address  // NOLINT
+  std::string direct_locking_script = "";  //!< direct_locking_script  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// UtxoJsonDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief UtxoJsonDataStruct struct
+ */
+struct UtxoJsonDataStruct {
+  std::string txid = "";                 //!< txid  // NOLINT
+  uint32_t vout = 0;                     //!< vout  // NOLINT
+  int64_t amount = 0;                    //!< amount  // NOLINT
+  std::string asset = "";                //!< asset  // NOLINT
+  std::string descriptor = "";           //!< descriptor  // NOLINT
+  std::string script_sig_template = "";  //!< script_sig_template  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // WitnessStackDataStruct
 // ------------------------------------------------------------------------
@@ -580,6 +763,36 @@ struct BlindTxOutRequestStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// BnbSearchOptionStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief BnbSearchOptionStruct struct
+ */
+struct BnbSearchOptionStruct {
+  uint32_t max_tries = 100000;  //!< max_tries  // NOLINT
+  uint32_t time_budget = 0;     //!< time_budget  // NOLINT
+  uint32_t thread_count = 1;    //!< thread_count  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// BnbSearchStatisticsStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief BnbSearchStatisticsStruct struct
+ */
+struct BnbSearchStatisticsStruct {
+  bool is_selected = false;    //!< is_selected  // NOLINT
+  int64_t tries = 0;           //!< tries  // NOLINT
+  int64_t elapsed_time = 0;    //!< elapsed_time  // NOLINT
+  uint32_t thread_count = 0;   //!< thread_count  // NOLINT
+  uint32_t subtree_count = 0;  //!< subtree_count  // NOLINT
+  bool is_timeout = false;     //!< is_timeout  // NOLINT
+  bool is_completed = false;   //!< is_completed  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // CoinSelectionFeeInformationFieldStruct
 // ------------------------------------------------------------------------
@@ -597,6 +810,32 @@ struct CoinSelectionFeeInformationFieldStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// CommitmentDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief CommitmentDataStruct struct
+ */
+struct CommitmentDataStruct {
+  std::string asset_commitment = "";   //!< asset_commitment  // NOLINT
+  std::string amount_commitment = "";  //!< amount_commitment  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// CommitmentTargetStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief CommitmentTargetStruct struct
+ */
+struct CommitmentTargetStruct {
+  int64_t amount = 0;                   //!< amount  // NOLINT
+  std::string asset = "";               //!< asset  // NOLINT
+  std::string asset_blind_factor = "";  //!< asset_blind_factor  // NOLINT
+  std::string blind_factor = "";        //!< blind_factor  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // CreateDescriptorKeyRequestStruct
 // ------------------------------------------------------------------------
@@ -629,6 +868,22 @@ struct CreateElementsSignatureHashTxInStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// CreateRawPeginRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief CreateRawPeginRequestStruct struct
+ */
+struct CreateRawPeginRequestStruct {
+  uint32_t version = 2;                        //!< version  // NOLINT
+  uint32_t locktime = 0;                       //!< locktime  // NOLINT
+  std::vector<ElementsPeginTxInStruct> txins;  //!< txins  // NOLINT
+  std::vector<ElementsTxOutStruct> txouts;     //!< txouts  // NOLINT
+  ElementsTxOutFeeStruct fee;                  //!< fee  // NOLINT
+  bool is_random_sort_tx_out = false;          //!< is_random_sort_tx_out  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // CreateSignatureHashTxInRequestStruct
 // ------------------------------------------------------------------------
@@ -653,6 +908,7 @@ struct CreateSignatureHashTxInRequestStruct {
  * @brief DecodePsbtInputStruct struct
  */
 struct DecodePsbtInputStruct {
+  uint32_t index = 0;                                       //!< index  // NOLINT
   std::string non_witness_utxo_hex = "";                    //!< non_witness_utxo_hex  // NOLINT
   DecodeRawTransactionResponseStruct non_witness_utxo;      //!< non_witness_utxo  // NOLINT
   DecodePsbtUtxoStruct witness_utxo;                        //!< witness_utxo  // NOLINT
@@ -674,6 +930,7 @@ struct DecodePsbtInputStruct {
  * @brief DecodePsbtOutputStruct struct
  */
 struct DecodePsbtOutputStruct {
+  uint32_t index = 0;                             //!< index  // NOLINT
   PsbtScriptDataStruct redeem_script;             //!< redeem_script  // NOLINT
   PsbtScriptDataStruct witness_script;            //!< witness_script  // NOLINT
   std::vector<PsbtBip32DataStruct> bip32_derivs;  //!< bip32_derivs  // NOLINT
@@ -700,6 +957,28 @@ struct DescriptorScriptJsonStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// EditRawTransactionOperationStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EditRawTransactionOperationStruct struct
+ */
+struct EditRawTransactionOperationStruct {
+  std::string type = "";                                   //!< type  // NOLINT
+  std::vector<TxInRequestStruct> txins;                    //!< txins  // NOLINT
+  std::vector<TxOutRequestStruct> txouts;                  //!< txouts  // NOLINT
+  std::vector<UpdateTxOutAmountDataStruct> update_txouts;  //!< update_txouts  // NOLINT
+  uint32_t index = 0;                                      //!< index  // NOLINT
+  std::vector<SplitTxOutDataStruct> split_txouts;          //!< split_txouts  // NOLINT
+  std::string txid = "";                                   //!< txid  // NOLINT
+  uint32_t vout = 0;                                       //!< vout  // NOLINT
+  uint32_t sequence = 0;                                   //!< sequence  // NOLINT
+  bool is_witness = true;                                  //!< is_witness  // NOLINT
+  std::vector<SignDataStruct> sign_params;                 //!< sign_params  // NOLINT
+  bool clear_stack = true;                                 //!< clear_stack  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // ElementsDecodeRawTransactionTxInStruct
 // ------------------------------------------------------------------------
@@ -740,6 +1019,12 @@ struct ElementsDecodeRawTransactionTxOutStruct {
   uint32_t n = 0;                                    //!< n  // NOLINT
   ElementsDecodeLockingScriptStruct script_pub_key;  //!< script_pub_key  // NOLINT
   std::string rangeproof = "";                       //!< rangeproof  // NOLINT
+  uint32_t surjectionproof_offset = 0;               //!< surjectionproof_offset  // NOLINT
+  uint32_t surjectionproof_size = 0;                 //!< surjectionproof_size  // NOLINT
+  std::string surjectionproof_hash = "";             //!< surjectionproof_hash  // NOLINT
+  uint32_t rangeproof_offset = 0;                    //!< rangeproof_offset  // NOLINT
+  uint32_t rangeproof_size = 0;                      //!< rangeproof_size  // NOLINT
+  std::string rangeproof_hash = "";                  //!< rangeproof_hash  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -756,22 +1041,6 @@ struct ElementsDestroyAmountStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
-// ------------------------------------------------------------------------
-// ElementsPeginTxInStruct
-// ------------------------------------------------------------------------
-/**
- * @brief ElementsPeginTxInStruct struct
- */
-struct ElementsPeginTxInStruct {
-  bool is_pegin = true;                         //!< is_pegin  // NOLINT
-  std::string txid = "";                        //!< txid  // NOLINT
-  uint32_t vout = 0;                            //!< vout  // NOLINT
-  uint32_t sequence = 4294967295;               //!< sequence  // NOLINT
-  ElementsAddPeginWitnessStruct peginwitness;   //!< peginwitness  // NOLINT
-  bool is_remove_mainchain_tx_witness = false;  //!< is_remove_mainchain_tx_witness  // NOLINT
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
 // ------------------------------------------------------------------------
 // ElementsPegoutTxOutStruct
 // ------------------------------------------------------------------------
@@ -794,30 +1063,53 @@ struct ElementsPegoutTxOutStruct {
 };
 
 // ------------------------------------------------------------------------
-// ElementsTxOutStruct
+// EstimateBlindProofSizeDataStruct
 // ------------------------------------------------------------------------
 /**
- * @brief ElementsTxOutStruct struct
+ * @brief EstimateBlindProofSizeDataStruct struct
  */
-struct ElementsTxOutStruct {
-  std::string address = "";                //!< address  // NOLINT
-  int64_t amount = 0;                      //!< amount  // NOLINT
-  std::string asset = "";                  //!< asset  // NOLINT
-  std::string direct_locking_script = "";  //!< direct_locking_script  // NOLINT
-  std::string direct_nonce = "";           //!< direct_nonce  // NOLINT
-  bool is_remove_nonce = false;            //!< is_remove_nonce  // NOLINT
+struct EstimateBlindProofSizeDataStruct {
+  uint32_t surjection_proof_size = 0;      //!< surjection_proof_size  // NOLINT
+  std::vector<uint32_t> rangeproof_sizes;  //!< rangeproof_sizes  // NOLINT
+  int64_t blind_weight = 0;                //!< blind_weight  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
 // ------------------------------------------------------------------------
-// ElementsTxOutFeeStruct
+// EstimateBlindProofSizeTransactionStruct
 // ------------------------------------------------------------------------
 /**
- * @brief ElementsTxOutFeeStruct struct
+ * @brief EstimateBlindProofSizeTransactionStruct struct
  */
-struct ElementsTxOutFeeStruct {
-  int64_t amount = 0;      //!< amount  // NOLINT
-  std::string asset = "";  //!< asset  // NOLINT
+struct EstimateBlindProofSizeTransactionStruct {
+  uint32_t surjection_input_count = 1;  //!< surjection_input_count  // NOLINT
+  std::vector<int64_t> amounts;         //!< amounts  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// EstimateTransactionSizeCandidateStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EstimateTransactionSizeCandidateStruct struct
+ */
+struct EstimateTransactionSizeCandidateStruct {
+  uint32_t surjection_input_count = 0;                //!< surjection_input_count  // NOLINT
+  std::vector<EstimateSizeInputDataStruct> inputs;    //!< inputs  // NOLINT
+  std::vector<EstimateSizeOutputDataStruct> outputs;  //!< outputs  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// EstimateTransactionSizeDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EstimateTransactionSizeDataStruct struct
+ */
+struct EstimateTransactionSizeDataStruct {
+  int64_t weight = 0;      //!< weight  // NOLINT
+  int64_t vsize = 0;       //!< vsize  // NOLINT
+  int64_t fee_amount = 0;  //!< fee_amount  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -940,40 +1232,6 @@ struct GetSighashTxInStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
-// ------------------------------------------------------------------------
-// IssuanceDataRequestStruct
-// ------------------------------------------------------------------------
-/**
- * @brief IssuanceDataRequestStruct struct
- */
-struct IssuanceDataRequestStruct {
-  std::string txid = "";           //!< txid  // NOLINT
-  uint32_t vout = 0;               //!< vout  // NOLINT
-  int64_t asset_amount = 0;        //!< asset_amount  // NOLINT
-  std::string asset_address = "";  //!< asset_address  // NOLINT
-  int64_t token_amount = 0;        //!< token_amount  // NOLINT
-  std::string token_address = "";  //!< token_address  // NOLINT
-  bool is_blind = true;            //!< is_blind  // NOLINT
-  std::string contract_hash = "";  //!< contract_hash  // NOLINT
-  bool is_remove_nonce = false;    //!< is_remove_nonce  // NOLINT
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
-// ------------------------------------------------------------------------
-// IssuanceDataResponseStruct
-// ------------------------------------------------------------------------
-/**
- * @brief IssuanceDataResponseStruct struct
- */
-struct IssuanceDataResponseStruct {
-  std::string txid = "";     //!< txid  // NOLINT
-  uint32_t vout = 0;         //!< vout  // NOLINT
-  std::string asset = "";    //!< asset  // NOLINT
-  std::string entropy = "";  //!< entropy  // NOLINT
-  std::string token = "";    //!< token  // NOLINT
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
 // ------------------------------------------------------------------------
 // PrivkeyDataStruct
 // ------------------------------------------------------------------------
@@ -1078,19 +1336,44 @@ struct PsbtRecordDataStruct {
 };
 
 // ------------------------------------------------------------------------
-// ReissuanceDataRequestStruct
+// RawTransactionResponseStruct
 // ------------------------------------------------------------------------
 /**
- * @brief ReissuanceDataRequestStruct struct
+ * @brief RawTransactionResponseStruct struct
  */
-struct ReissuanceDataRequestStruct {
-  std::string txid = "";                  //!< txid  // NOLINT
-  uint32_t vout = 0;                      //!< vout  // NOLINT
-  int64_t amount = 0;                     //!< amount  // NOLINT
-  std::string address = "";               //!< address  // NOLINT
-  std::string asset_blinding_nonce = "";  //!< asset_blinding_nonce  // NOLINT
-  std::string asset_entropy = "";         //!< asset_entropy  // NOLINT
-  bool is_remove_nonce = false;           //!< is_remove_nonce  // NOLINT
+struct RawTransactionResponseStruct {
+  std::string hex = "";  //!< hex  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// ScanUnblindOutputStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ScanUnblindOutputStruct struct
+ */
+struct ScanUnblindOutputStruct {
+  std::string txid = "";                //!< txid  // NOLINT
+  uint32_t index = 0;                   //!< index  // NOLINT
+  std::string locking_script = "";      //!< locking_script  // NOLINT
+  std::string asset = "";               //!< asset  // NOLINT
+  int64_t amount = 0;                   //!< amount  // NOLINT
+  std::string blind_factor = "";        //!< blind_factor  // NOLINT
+  std::string asset_blind_factor = "";  //!< asset_blind_factor  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// ScanUnblindScriptStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ScanUnblindScriptStruct struct
+ */
+struct ScanUnblindScriptStruct {
+  std::string address = "";         //!< address  // NOLINT
+  std::string locking_script = "";  //!< locking_script  // NOLINT
+  std::string blinding_key = "";    //!< blinding_key  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -1117,6 +1400,33 @@ struct SelectUtxoDataStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// SelectUtxosBatchPayoutStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SelectUtxosBatchPayoutStruct struct
+ */
+struct SelectUtxosBatchPayoutStruct {
+  int64_t target_amount = 0;                       //!< target_amount  // NOLINT
+  std::vector<TargetAmountMapDataStruct> targets;  //!< targets  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// SelectUtxosBatchResultStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SelectUtxosBatchResultStruct struct
+ */
+struct SelectUtxosBatchResultStruct {
+  std::vector<UtxoJsonDataStruct> utxos;                    //!< utxos  // NOLINT
+  int64_t selected_amount = 0;                              //!< selected_amount  // NOLINT
+  std::vector<TargetAmountMapDataStruct> selected_amounts;  //!< selected_amounts  // NOLINT
+  int64_t fee_amount = 0;                                   //!< fee_amount  // NOLINT
+  int64_t utxo_fee_amount = 0;                              //!< utxo_fee_amount  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // SerializeLedgerFormatTxOutStruct
 // ------------------------------------------------------------------------
@@ -1130,6 +1440,46 @@ struct SerializeLedgerFormatTxOutStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// SetRawIssuanceRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SetRawIssuanceRequestStruct struct
+ */
+struct SetRawIssuanceRequestStruct {
+  std::string tx = "";                                   //!< tx  // NOLINT
+  bool is_random_sort_tx_out = false;                    //!< is_random_sort_tx_out  // NOLINT
+  std::vector<IssuanceDataRequestStruct> issuances;      //!< issuances  // NOLINT
+  std::vector<ReissuanceDataRequestStruct> reissuances;  //!< reissuances  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// SetRawIssuanceResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SetRawIssuanceResponseStruct struct
+ */
+struct SetRawIssuanceResponseStruct {
+  std::string hex = "";                                 //!< hex  // NOLINT
+  std::vector<IssuanceDataResponseStruct> issuances;    //!< issuances  // NOLINT
+  std::vector<IssuanceDataResponseStruct> reissuances;  //!< reissuances  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// SighashDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SighashDataStruct struct
+ */
+struct SighashDataStruct {
+  std::string txid = "";     //!< txid  // NOLINT
+  uint32_t vout = 0;         //!< vout  // NOLINT
+  std::string sighash = "";  //!< sighash  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // SignWithPrivkeyTxInRequestStruct
 // ------------------------------------------------------------------------
@@ -1153,20 +1503,6 @@ struct SignWithPrivkeyTxInRequestStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
-// ------------------------------------------------------------------------
-// SplitTxOutDataStruct
-// ------------------------------------------------------------------------
-/**
- * @brief SplitTxOutDataStruct struct
- */
-struct SplitTxOutDataStruct {
-  int64_t amount = 0;                      //!< amount  // NOLINT
-  std::string address = "";                //!< address  // NOLINT
-  std::string direct_locking_script = "";  //!< direct_locking_script  // NOLINT
-  std::string direct_nonce = "";           //!< direct_nonce  // NOLINT
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
 // ------------------------------------------------------------------------
 // TapBranchDataStruct
 // ------------------------------------------------------------------------
@@ -1195,18 +1531,6 @@ struct TapScriptTreeItemStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
-// ------------------------------------------------------------------------
-// TargetAmountMapDataStruct
-// ------------------------------------------------------------------------
-/**
- * @brief TargetAmountMapDataStruct struct
- */
-struct TargetAmountMapDataStruct {
-  std::string asset = "";  //!< asset  // NOLINT
-  int64_t amount = 0;      //!< amount  // NOLINT
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
 // ------------------------------------------------------------------------
 // UnblindIssuanceStruct
 // ------------------------------------------------------------------------
@@ -1267,20 +1591,6 @@ struct UnblindTxOutStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
-// ------------------------------------------------------------------------
-// UpdateTxOutAmountDataStruct
-// ------------------------------------------------------------------------
-/**
- * @brief UpdateTxOutAmountDataStruct struct
- */
-struct UpdateTxOutAmountDataStruct {
-  int64_t amount = 0;                      //!< amount  // NOLINT
-  uint32_t index = 0;                      //!< index  // NOLINT
-  std::string address = "";                //!< address  // NOLINT
-  std::string direct_locking_script = "";  //!< direct_locking_script  // NOLINT
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
 // ------------------------------------------------------------------------
 // UpdateWitnessStackTxInRequestStruct
 // ------------------------------------------------------------------------
@@ -1289,24 +1599,8 @@ struct UpdateTxOutAmountDataStruct {
  */
 struct UpdateWitnessStackTxInRequestStruct {
   std::string txid = "";                 //!< txid  // NOLINT
-  uint32_t vout = 0;                     //!< vout  // NOLINT
-  WitnessStackDataStruct witness_stack;  //!< witness_stack  // NOLINT
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
-// ------------------------------------------------------------------------
-// UtxoJsonDataStruct
-// ------------------------------------------------------------------------
-/**
- * @brief UtxoJsonDataStruct struct
- */
-struct UtxoJsonDataStruct {
-  std::string txid = "";                 //!< txid  // NOLINT
-  uint32_t vout = 0;                     //!< vout  // NOLINT
-  int64_t amount = 0;                    //!< amount  // NOLINT
-  std::string asset = "";                //!< asset  // NOLINT
-  std::string descriptor = "";           //!< descriptor  // NOLINT
-  std::string script_sig_template = "";  //!< script_sig_template  // NOLINT
+  uint32_t vout = 0;                     //!< vout  // NOLINT
+  WitnessStackDataStruct witness_stack;  //!< witness_stack  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -1332,6 +1626,23 @@ struct UtxoObjectStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// UtxoPoolItemDataStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief UtxoPoolItemDataStruct struct
+ */
+struct UtxoPoolItemDataStruct {
+  std::string txid = "";                 //!< txid  // NOLINT
+  uint32_t vout = 0;                     //!< vout  // NOLINT
+  int64_t amount = 0;                    //!< amount  // NOLINT
+  std::string address = "";              //!< address  // NOLINT
+  std::string asset = "";                //!< asset  // NOLINT
+  std::string descriptor = "";           //!< descriptor  // NOLINT
+  std::string script_sig_template = "";  //!< script_sig_template  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // VerifySignatureTxInRequestStruct
 // ------------------------------------------------------------------------
@@ -1409,18 +1720,6 @@ struct AddMultisigSignRequestStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
-// ------------------------------------------------------------------------
-// RawTransactionResponseStruct
-// ------------------------------------------------------------------------
-/**
- * @brief RawTransactionResponseStruct struct
- */
-struct RawTransactionResponseStruct {
-  std::string hex = "";  //!< hex  // NOLINT
-  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
-  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
-};
-
 // ------------------------------------------------------------------------
 // AddPsbtDataRequestStruct
 // ------------------------------------------------------------------------
@@ -1525,6 +1824,32 @@ struct AddTapscriptSignRequestStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// AddUtxoPoolItemsRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief AddUtxoPoolItemsRequestStruct struct
+ */
+struct AddUtxoPoolItemsRequestStruct {
+  uint32_t pool_id = 0;                       //!< pool_id  // NOLINT
+  std::vector<UtxoPoolItemDataStruct> utxos;  //!< utxos  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// UtxoPoolInfoResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief UtxoPoolInfoResponseStruct struct
+ */
+struct UtxoPoolInfoResponseStruct {
+  uint32_t pool_id = 0;       //!< pool_id  // NOLINT
+  uint32_t count = 0;         //!< count  // NOLINT
+  uint32_t locked_count = 0;  //!< locked_count  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // AnalyzeTapScriptTreeRequestStruct
 // ------------------------------------------------------------------------
@@ -2002,6 +2327,17 @@ struct CreateScriptRequestStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// CreateUtxoPoolRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief CreateUtxoPoolRequestStruct struct
+ */
+struct CreateUtxoPoolRequestStruct {
+  bool is_elements = false;  //!< is_elements  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // DecodeBase58RequestStruct
 // ------------------------------------------------------------------------
@@ -2068,10 +2404,15 @@ struct DecodeDerSignatureToRawRequestStruct {
  * @brief DecodePsbtRequestStruct struct
  */
 struct DecodePsbtRequestStruct {
-  std::string psbt = "";            //!< psbt  // NOLINT
-  std::string network = "mainnet";  //!< network  // NOLINT
-  bool has_detail = false;          //!< has_detail  // NOLINT
-  bool has_simple = false;          //!< has_simple  // NOLINT
+  std::string psbt = "";                 //!< psbt  // NOLINT
+  std::string network = "mainnet";       //!< network  // NOLINT
+  bool has_detail = false;               //!< has_detail  // NOLINT
+  bool has_simple = false;               //!< has_simple  // NOLINT
+  std::vector<uint32_t> input_indexes;   //!< input_indexes  // NOLINT
+  std::vector<uint32_t> output_indexes;  //!< output_indexes  // NOLINT
+  bool skip_utxo_transaction = false;    //!< skip_utxo_transaction  // NOLINT
+  bool skip_asm = false;                 //!< skip_asm  // NOLINT
+  bool has_summary = false;              //!< has_summary  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -2090,6 +2431,10 @@ struct DecodePsbtResponseStruct {
   std::vector<DecodePsbtInputStruct> inputs;    //!< inputs  // NOLINT
   std::vector<DecodePsbtOutputStruct> outputs;  //!< outputs  // NOLINT
   int64_t fee = 0;                              //!< fee  // NOLINT
+  uint32_t input_count = 0;                     //!< input_count  // NOLINT
+  uint32_t output_count = 0;                    //!< output_count  // NOLINT
+  uint32_t signed_input_count = 0;              //!< signed_input_count  // NOLINT
+  uint32_t finalized_input_count = 0;           //!< finalized_input_count  // NOLINT
   cfd::js::api::InnerErrorResponseStruct error;   //!< error information
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
@@ -2104,6 +2449,32 @@ struct DecodeRawTransactionRequestStruct {
   std::string hex = "";             //!< hex  // NOLINT
   std::string network = "mainnet";  //!< network  // NOLINT
   bool iswitness = true;            //!< iswitness  // NOLINT
+  bool skip_asm = false;            //!< skip_asm  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// DeleteUtxoPoolRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief DeleteUtxoPoolRequestStruct struct
+ */
+struct DeleteUtxoPoolRequestStruct {
+  uint32_t pool_id = 0;  //!< pool_id  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// EditRawTransactionRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EditRawTransactionRequestStruct struct
+ */
+struct EditRawTransactionRequestStruct {
+  std::string tx = "";                                        //!< tx  // NOLINT
+  uint32_t version = 2;                                       //!< version  // NOLINT
+  uint32_t locktime = 0;                                      //!< locktime  // NOLINT
+  std::vector<EditRawTransactionOperationStruct> operations;  //!< operations  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -2212,18 +2583,27 @@ struct CreatePegoutAddressResponseStruct {
 };
 
 // ------------------------------------------------------------------------
-// CreateRawPeginRequestStruct
+// CreateRawPeginBatchRequestStruct
 // ------------------------------------------------------------------------
 /**
- * @brief CreateRawPeginRequestStruct struct
+ * @brief CreateRawPeginBatchRequestStruct struct
  */
-struct CreateRawPeginRequestStruct {
-  uint32_t version = 2;                        //!< version  // NOLINT
-  uint32_t locktime = 0;                       //!< locktime  // NOLINT
-  std::vector<ElementsPeginTxInStruct> txins;  //!< txins  // NOLINT
-  std::vector<ElementsTxOutStruct> txouts;     //!< txouts  // NOLINT
-  ElementsTxOutFeeStruct fee;                  //!< fee  // NOLINT
-  bool is_random_sort_tx_out = false;          //!< is_random_sort_tx_out  // NOLINT
+struct CreateRawPeginBatchRequestStruct {
+  std::vector<CreateRawPeginRequestStruct> requests;  //!< requests  // NOLINT
+  uint32_t thread_count = 0;                          //!< thread_count  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// CreateRawPeginBatchResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief CreateRawPeginBatchResponseStruct struct
+ */
+struct CreateRawPeginBatchResponseStruct {
+  std::vector<RawTransactionResponseStruct> results;  //!< results  // NOLINT
+  uint32_t verified_proof_count = 0;                  //!< verified_proof_count  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -2278,11 +2658,13 @@ struct ElementsCreateRawTransactionRequestStruct {
  * @brief ElementsDecodeRawTransactionRequestStruct struct
  */
 struct ElementsDecodeRawTransactionRequestStruct {
-  std::string hex = "";                //!< hex  // NOLINT
-  std::string network = "liquidv1";    //!< network  // NOLINT
-  std::string mainchain_network = "";  //!< mainchain_network  // NOLINT
-  bool iswitness = true;               //!< iswitness  // NOLINT
-  bool full_dump = false;              //!< full_dump  // NOLINT
+  std::string hex = "";                        //!< hex  // NOLINT
+  std::string network = "liquidv1";            //!< network  // NOLINT
+  std::string mainchain_network = "";          //!< mainchain_network  // NOLINT
+  bool iswitness = true;                       //!< iswitness  // NOLINT
+  bool full_dump = false;                      //!< full_dump  // NOLINT
+  bool skip_proof = false;                     //!< skip_proof  // NOLINT
+  std::vector<uint32_t> decode_proof_indexes;  //!< decode_proof_indexes  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -2356,6 +2738,30 @@ struct GetUnblindedAddressResponseStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// SetRawIssuanceBatchRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SetRawIssuanceBatchRequestStruct struct
+ */
+struct SetRawIssuanceBatchRequestStruct {
+  std::vector<SetRawIssuanceRequestStruct> requests;  //!< requests  // NOLINT
+  uint32_t thread_count = 0;                          //!< thread_count  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// SetRawIssuanceBatchResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SetRawIssuanceBatchResponseStruct struct
+ */
+struct SetRawIssuanceBatchResponseStruct {
+  std::vector<SetRawIssuanceResponseStruct> results;  //!< results  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // SetRawIssueAssetRequestStruct
 // ------------------------------------------------------------------------
@@ -2485,6 +2891,31 @@ struct EncodeSignatureByDerResponseStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// EstimateBlindProofSizeRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EstimateBlindProofSizeRequestStruct struct
+ */
+struct EstimateBlindProofSizeRequestStruct {
+  int exponent = 0;                                          //!< exponent  // NOLINT
+  int minimum_bits = 52;                                     //!< minimum_bits  // NOLINT
+  std::vector<EstimateBlindProofSizeTransactionStruct> txs;  //!< txs  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// EstimateBlindProofSizeResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EstimateBlindProofSizeResponseStruct struct
+ */
+struct EstimateBlindProofSizeResponseStruct {
+  std::vector<EstimateBlindProofSizeDataStruct> txs;  //!< txs  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // EstimateFeeRequestStruct
 // ------------------------------------------------------------------------
@@ -2518,6 +2949,33 @@ struct EstimateFeeResponseStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// EstimateTransactionSizeRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EstimateTransactionSizeRequestStruct struct
+ */
+struct EstimateTransactionSizeRequestStruct {
+  bool is_elements = false;                                        //!< is_elements  // NOLINT
+  double fee_rate = 1;                                             //!< fee_rate  // NOLINT
+  int exponent = 0;                                                //!< exponent  // NOLINT
+  int minimum_bits = 52;                                           //!< minimum_bits  // NOLINT
+  std::vector<EstimateTransactionSizeCandidateStruct> candidates;  //!< candidates  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// EstimateTransactionSizeResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief EstimateTransactionSizeResponseStruct struct
+ */
+struct EstimateTransactionSizeResponseStruct {
+  std::vector<EstimateTransactionSizeDataStruct> results;  //!< results  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // ExtractSecretEcdsaAdaptorRequestStruct
 // ------------------------------------------------------------------------
@@ -2620,6 +3078,7 @@ struct FundPsbtResponseStruct {
  */
 struct FundRawTransactionRequestStruct {
   std::vector<FundUtxoJsonDataStruct> utxos;           //!< utxos  // NOLINT
+  uint32_t utxo_pool_id = 0;                           //!< utxo_pool_id  // NOLINT
   std::vector<FundSelectUtxoDataStruct> select_utxos;  //!< select_utxos  // NOLINT
   std::string tx = "";                                 //!< tx  // NOLINT
   bool is_elements = false;                            //!< is_elements  // NOLINT
@@ -2760,6 +3219,29 @@ struct GetCommitmentResponseStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// GetCommitmentsRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief GetCommitmentsRequestStruct struct
+ */
+struct GetCommitmentsRequestStruct {
+  std::vector<CommitmentTargetStruct> targets;  //!< targets  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// GetCommitmentsResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief GetCommitmentsResponseStruct struct
+ */
+struct GetCommitmentsResponseStruct {
+  std::vector<CommitmentDataStruct> commitments;  //!< commitments  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // GetDefaultBlindingKeyRequestStruct
 // ------------------------------------------------------------------------
@@ -2785,6 +3267,31 @@ struct BlindingKeyResponseStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// GetDefaultBlindingKeyBatchRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief GetDefaultBlindingKeyBatchRequestStruct struct
+ */
+struct GetDefaultBlindingKeyBatchRequestStruct {
+  std::string master_blinding_key = "";      //!< master_blinding_key  // NOLINT
+  std::vector<std::string> locking_scripts;  //!< locking_scripts  // NOLINT
+  bool use_cache = false;                    //!< use_cache  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// GetDefaultBlindingKeyBatchResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief GetDefaultBlindingKeyBatchResponseStruct struct
+ */
+struct GetDefaultBlindingKeyBatchResponseStruct {
+  std::vector<std::string> blinding_keys;  //!< blinding_keys  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // GetExtkeyInfoRequestStruct
 // ------------------------------------------------------------------------
@@ -2827,6 +3334,21 @@ struct GetIssuanceBlindingKeyRequestStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// GetLockingScriptCacheInfoResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief GetLockingScriptCacheInfoResponseStruct struct
+ */
+struct GetLockingScriptCacheInfoResponseStruct {
+  int64_t capacity = 0;    //!< capacity  // NOLINT
+  int64_t size = 0;        //!< size  // NOLINT
+  int64_t hit_count = 0;   //!< hit_count  // NOLINT
+  int64_t miss_count = 0;  //!< miss_count  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // GetMnemonicWordlistRequestStruct
 // ------------------------------------------------------------------------
@@ -2988,6 +3510,32 @@ struct CreateSignatureHashResponseStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// GetSighashesRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief GetSighashesRequestStruct struct
+ */
+struct GetSighashesRequestStruct {
+  std::string tx = "";                      //!< tx  // NOLINT
+  bool is_elements = false;                 //!< is_elements  // NOLINT
+  std::vector<GetSighashTxInStruct> txins;  //!< txins  // NOLINT
+  std::vector<UtxoObjectStruct> utxos;      //!< utxos  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// GetSighashesResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief GetSighashesResponseStruct struct
+ */
+struct GetSighashesResponseStruct {
+  std::vector<SighashDataStruct> sighashes;  //!< sighashes  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // GetTapBranchInfoRequestStruct
 // ------------------------------------------------------------------------
@@ -3231,6 +3779,19 @@ struct IsFinalizedPsbtResponseStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// LockUtxoPoolItemsRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief LockUtxoPoolItemsRequestStruct struct
+ */
+struct LockUtxoPoolItemsRequestStruct {
+  uint32_t pool_id = 0;                   //!< pool_id  // NOLINT
+  std::vector<OutPointStruct> outpoints;  //!< outpoints  // NOLINT
+  bool is_lock = true;                    //!< is_lock  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // CreateMultisigRequestStruct
 // ------------------------------------------------------------------------
@@ -3329,6 +3890,82 @@ struct ParseScriptResponseStruct {
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
+// ------------------------------------------------------------------------
+// RemoveUtxoPoolItemsRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief RemoveUtxoPoolItemsRequestStruct struct
+ */
+struct RemoveUtxoPoolItemsRequestStruct {
+  uint32_t pool_id = 0;                   //!< pool_id  // NOLINT
+  std::vector<OutPointStruct> outpoints;  //!< outpoints  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// ReselectUtxosRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ReselectUtxosRequestStruct struct
+ */
+struct ReselectUtxosRequestStruct {
+  std::vector<UtxoJsonDataStruct> utxos;            //!< utxos  // NOLINT
+  uint32_t utxo_pool_id = 0;                        //!< utxo_pool_id  // NOLINT
+  std::vector<UtxoJsonDataStruct> previous_utxos;   //!< previous_utxos  // NOLINT
+  std::string selection_state = "";                 //!< selection_state  // NOLINT
+  bool is_elements = false;                         //!< is_elements  // NOLINT
+  int64_t target_amount = 0;                        //!< target_amount  // NOLINT
+  std::vector<TargetAmountMapDataStruct> targets;   //!< targets  // NOLINT
+  CoinSelectionFeeInformationFieldStruct fee_info;  //!< fee_info  // NOLINT
+  BnbSearchOptionStruct bnb_option;                 //!< bnb_option  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// ReselectUtxosResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ReselectUtxosResponseStruct struct
+ */
+struct ReselectUtxosResponseStruct {
+  std::vector<UtxoJsonDataStruct> utxos;                    //!< utxos  // NOLINT
+  std::vector<UtxoJsonDataStruct> added_utxos;              //!< added_utxos  // NOLINT
+  int64_t selected_amount = 0;                              //!< selected_amount  // NOLINT
+  std::vector<TargetAmountMapDataStruct> selected_amounts;  //!< selected_amounts  // NOLINT
+  int64_t fee_amount = 0;                                   //!< fee_amount  // NOLINT
+  int64_t utxo_fee_amount = 0;                              //!< utxo_fee_amount  // NOLINT
+  bool is_full_search = false;                              //!< is_full_search  // NOLINT
+  std::string selection_state = "";                         //!< selection_state  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// ScanAndUnblindRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ScanAndUnblindRequestStruct struct
+ */
+struct ScanAndUnblindRequestStruct {
+  std::vector<std::string> txs;                  //!< txs  // NOLINT
+  std::vector<ScanUnblindScriptStruct> scripts;  //!< scripts  // NOLINT
+  std::string master_blinding_key = "";          //!< master_blinding_key  // NOLINT
+  uint32_t thread_count = 0;                     //!< thread_count  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// ScanAndUnblindResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief ScanAndUnblindResponseStruct struct
+ */
+struct ScanAndUnblindResponseStruct {
+  std::vector<ScanUnblindOutputStruct> outputs;  //!< outputs  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
 // ------------------------------------------------------------------------
 // SchnorrSignRequestStruct
 // ------------------------------------------------------------------------
@@ -3390,10 +4027,14 @@ struct SchnorrVerifyResponseStruct {
  */
 struct SelectUtxosRequestStruct {
   std::vector<UtxoJsonDataStruct> utxos;            //!< utxos  // NOLINT
+  uint32_t utxo_pool_id = 0;                        //!< utxo_pool_id  // NOLINT
   int64_t target_amount = 0;                        //!< target_amount  // NOLINT
   bool is_elements = false;                         //!< is_elements  // NOLINT
   std::vector<TargetAmountMapDataStruct> targets;   //!< targets  // NOLINT
   CoinSelectionFeeInformationFieldStruct fee_info;  //!< fee_info  // NOLINT
+  std::string selection_mode = "default";           //!< selection_mode  // NOLINT
+  bool parallel_asset_selection = false;            //!< parallel_asset_selection  // NOLINT
+  BnbSearchOptionStruct bnb_option;                 //!< bnb_option  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -3409,6 +4050,38 @@ struct SelectUtxosResponseStruct {
   std::vector<TargetAmountMapDataStruct> selected_amounts;  //!< selected_amounts  // NOLINT
   int64_t fee_amount = 0;                                   //!< fee_amount  // NOLINT
   int64_t utxo_fee_amount = 0;                              //!< utxo_fee_amount  // NOLINT
+  BnbSearchStatisticsStruct bnb_statistics;                 //!< bnb_statistics  // NOLINT
+  std::string selection_state = "";                         //!< selection_state  // NOLINT
+  cfd::js::api::InnerErrorResponseStruct error;   //!< error information
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// SelectUtxosBatchRequestStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SelectUtxosBatchRequestStruct struct
+ */
+struct SelectUtxosBatchRequestStruct {
+  std::vector<UtxoJsonDataStruct> utxos;              //!< utxos  // NOLINT
+  uint32_t utxo_pool_id = 0;                          //!< utxo_pool_id  // NOLINT
+  bool lock_selected_utxos = false;                   //!< lock_selected_utxos  // NOLINT
+  bool is_elements = false;                           //!< is_elements  // NOLINT
+  std::vector<SelectUtxosBatchPayoutStruct> payouts;  //!< payouts  // NOLINT
+  CoinSelectionFeeInformationFieldStruct fee_info;    //!< fee_info  // NOLINT
+  BnbSearchOptionStruct bnb_option;                   //!< bnb_option  // NOLINT
+  std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
+};
+
+// ------------------------------------------------------------------------
+// SelectUtxosBatchResponseStruct
+// ------------------------------------------------------------------------
+/**
+ * @brief SelectUtxosBatchResponseStruct struct
+ */
+struct SelectUtxosBatchResponseStruct {
+  std::vector<SelectUtxosBatchResultStruct> results;  //!< results  // NOLINT
+  int64_t total_fee_amount = 0;                       //!< total_fee_amount  // NOLINT
   cfd::js::api::InnerErrorResponseStruct error;   //!< error information
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
@@ -3524,9 +4197,12 @@ struct SignEcdsaAdaptorResponseStruct {
  * @brief SignPsbtRequestStruct struct
  */
 struct SignPsbtRequestStruct {
-  std::string psbt = "";     //!< psbt  // NOLINT
-  std::string privkey = "";  //!< privkey  // NOLINT
-  bool has_grind_r = true;   //!< has_grind_r  // NOLINT
+  std::string psbt = "";              //!< psbt  // NOLINT
+  std::string privkey = "";           //!< privkey  // NOLINT
+  std::vector<std::string> privkeys;  //!< privkeys  // NOLINT
+  std::string xprv = "";              //!< xprv  // NOLINT
+  bool has_grind_r = true;            //!< has_grind_r  // NOLINT
+  uint32_t thread_count = 0;          //!< thread_count  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
@@ -3675,6 +4351,7 @@ struct VerifyEcdsaAdaptorRequestStruct {
 struct VerifyPsbtSignRequestStruct {
   std::string psbt = "";                       //!< psbt  // NOLINT
   std::vector<OutPointStruct> out_point_list;  //!< out_point_list  // NOLINT
+  uint32_t thread_count = 0;                   //!< thread_count  // NOLINT
   std::set<std::string> ignore_items;   //!< using on JSON mapping convert.
 };
 
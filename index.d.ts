@@ -216,6 +216,16 @@ export interface AddTapscriptSignTxInRequest {
     annex?: string;
 }
 
+/**
+ * Request for add utxos to the utxo pool.
+ * @property {number} poolId - utxo pool id.
+ * @property {UtxoPoolItemData[]} utxos - utxo data.
+ */
+export interface AddUtxoPoolItemsRequest {
+    poolId: number;
+    utxos: UtxoPoolItemData[];
+}
+
 /**
  * TapScript tree information
  * @property {TapScriptTreeItem[]} branches - TapScript tree item
@@ -394,6 +404,38 @@ export interface BlockTxRequest {
     txid: string;
 }
 
+/**
+ * BnB search option.
+ * @property {number} maxTries? - search iteration cap of all threads.
+ * @property {number} timeBudget? - search time budget (msec). 0 is unlimited. (When the budget expires, the best solution found so far is used.)
+ * @property {number} threadCount? - search thread count. 0 is the hardware thread count. (On wasm, the search runs on a single thread.)
+ */
+export interface BnbSearchOption {
+    maxTries?: number;
+    timeBudget?: number;
+    threadCount?: number;
+}
+
+/**
+ * BnB search statistics.
+ * @property {boolean} isSelected - selected by BnB.
+ * @property {bigint} tries - search iteration count.
+ * @property {bigint} elapsedTime - search time (microseconds).
+ * @property {number} threadCount - search thread count.
+ * @property {number} subtreeCount - split subtree count.
+ * @property {boolean} isTimeout - stopped by the time budget.
+ * @property {boolean} isCompleted - whole search tree explored.
+ */
+export interface BnbSearchStatistics {
+    isSelected: boolean;
+    tries: bigint;
+    elapsedTime: bigint;
+    threadCount: number;
+    subtreeCount: number;
+    isTimeout: boolean;
+    isCompleted: boolean;
+}
+
 /**
  * request ec signature data.
  * @property {string} sighash - signature hash.
@@ -440,6 +482,30 @@ export interface CoinSelectionFeeInformationField {
     minimumBits?: number;
 }
 
+/**
+ * commitment data.
+ * @property {string} assetCommitment - asset commitment
+ * @property {string} amountCommitment - amount commitment
+ */
+export interface CommitmentData {
+    assetCommitment: string;
+    amountCommitment: string;
+}
+
+/**
+ * commitment target data.
+ * @property {bigint | number} amount - satoshi amount
+ * @property {string} asset - asset
+ * @property {string} assetBlindFactor - asset blind factor
+ * @property {string} blindFactor - amount blind factor
+ */
+export interface CommitmentTarget {
+    amount: bigint | number;
+    asset: string;
+    assetBlindFactor: string;
+    blindFactor: string;
+}
+
 /**
  * Request for compute sigpoint on schnorr
  * @property {string} message - message data. (32-byte hash, or text message.)
@@ -854,6 +920,26 @@ export interface CreatePegoutAddressResponse {
     baseDescriptor: string;
 }
 
+/**
+ * Request for create pegin transactions.
+ * @property {CreateRawPeginRequest[]} requests - Request for create pegin transaction
+ * @property {number} threadCount? - thread count. (0: hardware threads)
+ */
+export interface CreateRawPeginBatchRequest {
+    requests: CreateRawPeginRequest[];
+    threadCount?: number;
+}
+
+/**
+ * The output pegin transaction list.
+ * @property {RawTransactionResponse[]} results - The output transaction data.
+ * @property {number} verifiedProofCount - count of the distinct txoutproofs verified. each claim is checked against its own txoutproof.
+ */
+export interface CreateRawPeginBatchResponse {
+    results: RawTransactionResponse[];
+    verifiedProofCount: number;
+}
+
 /**
  * Request for create pegin transaction
  * @property {number} version? - transaction version
@@ -959,6 +1045,14 @@ export interface CreateSignatureHashTxInRequest {
     sighashAnyoneCanPay?: boolean;
 }
 
+/**
+ * Request for create the utxo pool.
+ * @property {boolean} isElements? - elements utxo flag.
+ */
+export interface CreateUtxoPoolRequest {
+    isElements?: boolean;
+}
+
 /**
  * Request for decode base58
  * @property {string} data - base58 data
@@ -1003,6 +1097,7 @@ export interface DecodeLockingScript {
 
 /**
  * psbt input data
+ * @property {number} index? - If inputIndexes is set, txin index is set.
  * @property {string} non_witness_utxo_hex? - If hasDetail is true, tx hex for not witness set.
  * @property {DecodeRawTransactionResponse} non_witness_utxo? - utxo for not witness. If hasDetail and hasSimple are true, this field is disabled.
  * @property {DecodePsbtUtxo} witness_utxo? - utxo for witness
@@ -1016,6 +1111,7 @@ export interface DecodeLockingScript {
  * @property {PsbtMapData[]} unknown? - psbt map data.
  */
 export interface DecodePsbtInput {
+    index?: number;
     non_witness_utxo_hex?: string;
     non_witness_utxo?: DecodeRawTransactionResponse;
     witness_utxo?: DecodePsbtUtxo;
@@ -1044,12 +1140,14 @@ export interface DecodePsbtLockingScript {
 
 /**
  * psbt output data
+ * @property {number} index? - If outputIndexes is set, txout index is set.
  * @property {PsbtScriptData} redeem_script? - redeem script
  * @property {PsbtScriptData} witness_script? - witness script
  * @property {PsbtBip32Data[]} bip32_derivs? - psbt script data
  * @property {PsbtMapData[]} unknown? - psbt map data.
  */
 export interface DecodePsbtOutput {
+    index?: number;
     redeem_script?: PsbtScriptData;
     witness_script?: PsbtScriptData;
     bip32_derivs?: PsbtBip32Data[];
@@ -1062,24 +1160,38 @@ export interface DecodePsbtOutput {
  * @property {string} network? - network type (mainnet, testnet, regtest)
  * @property {boolean} hasDetail? - detail dump option.
  * @property {boolean} hasSimple? - simple dump option.
+ * @property {number[]} inputIndexes? - decode target input index list. If list is empty, all inputs are decoded.
+ * @property {number[]} outputIndexes? - decode target output index list. If list is empty, all outputs are decoded.
+ * @property {boolean} skipUtxoTransaction? - If true, non_witness_utxo is not decoded.
+ * @property {boolean} skipAsm? - If true, script asm is not rendered. (set empty string)
+ * @property {boolean} hasSummary? - summary dump option. Only counts, fee and signing status are set.
  */
 export interface DecodePsbtRequest {
     psbt: string;
     network?: string;
     hasDetail?: boolean;
     hasSimple?: boolean;
+    inputIndexes?: number[];
+    outputIndexes?: number[];
+    skipUtxoTransaction?: boolean;
+    skipAsm?: boolean;
+    hasSummary?: boolean;
 }
 
 /**
  * response data of decode psbt.
- * @property {DecodeRawTransactionResponse} tx? - transaction data. If hasDetail and hasSimple are true, this field is disabled.
+ * @property {DecodeRawTransactionResponse} tx? - transaction data. If hasDetail and hasSimple are true, or hasSummary is true, this field is disabled.
  * @property {string} tx_hex? - If hasDetail is true, tx hex set.
  * @property {PsbtGlobalXpub[]} xpubs? - psbt global xpub data
  * @property {number} version? - If hasDetail is true, psbt version set. (remove from global unknown)
  * @property {PsbtMapData[]} unknown? - psbt map data.
- * @property {DecodePsbtInput[]} inputs - psbt input data
- * @property {DecodePsbtOutput[]} outputs - psbt output data
+ * @property {DecodePsbtInput[]} inputs? - psbt input data
+ * @property {DecodePsbtOutput[]} outputs? - psbt output data
  * @property {bigint} fee? - If all utxos filled, this field has set fee amount.
+ * @property {number} input_count? - If hasSummary is true, txin count is set.
+ * @property {number} output_count? - If hasSummary is true, txout count is set.
+ * @property {number} signed_input_count? - If hasSummary is true, count of the inputs with partial signatures is set.
+ * @property {number} finalized_input_count? - If hasSummary is true, count of the finalized inputs is set.
  */
 export interface DecodePsbtResponse {
     tx?: DecodeRawTransactionResponse;
@@ -1087,9 +1199,13 @@ export interface DecodePsbtResponse {
     xpubs?: PsbtGlobalXpub[];
     version?: number;
     unknown?: PsbtMapData[];
-    inputs: DecodePsbtInput[];
-    outputs: DecodePsbtOutput[];
+    inputs?: DecodePsbtInput[];
+    outputs?: DecodePsbtOutput[];
     fee?: bigint;
+    input_count?: number;
+    output_count?: number;
+    signed_input_count?: number;
+    finalized_input_count?: number;
 }
 
 /**
@@ -1106,11 +1222,13 @@ export interface DecodePsbtUtxo {
  * @property {string} hex - transaction hex
  * @property {string} network? - network type
  * @property {boolean} iswitness? - dump witness (unused)
+ * @property {boolean} skipAsm? - If true, script asm is not rendered. (set empty string)
  */
 export interface DecodeRawTransactionRequest {
     hex: string;
     network?: string;
     iswitness?: boolean;
+    skipAsm?: boolean;
 }
 
 /**
@@ -1176,6 +1294,14 @@ export interface DecodeUnlockingScript {
     hex: string;
 }
 
+/**
+ * Request for delete the utxo pool.
+ * @property {number} poolId - utxo pool id.
+ */
+export interface DeleteUtxoPoolRequest {
+    poolId: number;
+}
+
 /**
  * @property {string} keyType - contain key type (pubkey, extPubkey, extPrivkey, schnorrPubkey)
  * @property {string} key - key value (hex or base58)
@@ -1209,6 +1335,50 @@ export interface DescriptorScriptJson {
     reqNum?: number;
 }
 
+/**
+ * The edit operation data.
+ * @property {string} type - operation type. (addRaw, updateTxOutAmount, splitTxOut, updateTxInSequence, addSign)
+ * @property {TxInRequest[]} txins? - The data added to the transaction input.
+ * @property {TxOutRequest[]} txouts? - The data added to the transaction output.
+ * @property {UpdateTxOutAmountData[]} updateTxouts? - target txout
+ * @property {number} index? - (splitTxOut) split target txout index.
+ * @property {SplitTxOutData[]} splitTxouts? - add txout data for split
+ * @property {string} txid? - (updateTxInSequence, addSign) utxo txid.
+ * @property {number} vout? - (updateTxInSequence, addSign) utxo vout.
+ * @property {number} sequence? - (updateTxInSequence) sequence number
+ * @property {boolean} isWitness? - (addSign) use witness stack flag.
+ * @property {SignData[]} signParams? - The sign data.
+ * @property {boolean} clearStack? - (addSign) Clear the stack before addSign. If isWitness is false, clearStack is forced to be true.
+ */
+export interface EditRawTransactionOperation {
+    type: string;
+    txins?: TxInRequest[];
+    txouts?: TxOutRequest[];
+    updateTxouts?: UpdateTxOutAmountData[];
+    index?: number;
+    splitTxouts?: SplitTxOutData[];
+    txid?: string;
+    vout?: number;
+    sequence?: number;
+    isWitness?: boolean;
+    signParams?: SignData[];
+    clearStack?: boolean;
+}
+
+/**
+ * Request for edit transaction.
+ * @property {string} tx? - base transaction hex. If empty, a new transaction is created.
+ * @property {number} version? - transaction version (when creating a new transaction)
+ * @property {number} locktime? - locktime (when creating a new transaction)
+ * @property {EditRawTransactionOperation[]} operations - The edit operation data.
+ */
+export interface EditRawTransactionRequest {
+    tx?: string;
+    version?: number;
+    locktime?: number;
+    operations: EditRawTransactionOperation[];
+}
+
 /**
  * Pegin's witness stack
  * @property {bigint | number} amount - pegin amount
@@ -1340,6 +1510,8 @@ export interface ElementsDecodeLockingScript {
  * @property {string} mainchainNetwork? - mainchain network type (mainnet, testnet, regtest or blank. Must be set for pegout transactions.)
  * @property {boolean} iswitness? - dump witness (unused)
  * @property {boolean} fullDump? - tx data all dump option.
+ * @property {boolean} skipProof? - output proofs are not decoded, and only their offset, size and hash are dumped.
+ * @property {number[]} decodeProofIndexes? - output indexes to decode the proofs on skipProof mode.
  */
 export interface ElementsDecodeRawTransactionRequest {
     hex: string;
@@ -1347,6 +1519,8 @@ export interface ElementsDecodeRawTransactionRequest {
     mainchainNetwork?: string;
     iswitness?: boolean;
     fullDump?: boolean;
+    skipProof?: boolean;
+    decodeProofIndexes?: number[];
 }
 
 /**
@@ -1417,6 +1591,12 @@ export interface ElementsDecodeRawTransactionTxIn {
  * @property {number} n - vout number
  * @property {ElementsDecodeLockingScript} scriptPubKey? - locking script
  * @property {string} rangeproof? - value rangeproof (Displayed only when the full dump option is used.)
+ * @property {number} surjectionproof_offset? - surjectionproof byte offset in the transaction (Displayed only when the skipProof option is used.)
+ * @property {number} surjectionproof_size? - surjectionproof byte size (Displayed only when the skipProof option is used.)
+ * @property {string} surjectionproof_hash? - surjectionproof sha256 hash (Displayed only when the skipProof option is used.)
+ * @property {number} rangeproof_offset? - rangeproof byte offset in the transaction (Displayed only when the skipProof option is used.)
+ * @property {number} rangeproof_size? - rangeproof byte size (Displayed only when the skipProof option is used.)
+ * @property {string} rangeproof_hash? - rangeproof sha256 hash (Displayed only when the skipProof option is used.)
  */
 export interface ElementsDecodeRawTransactionTxOut {
     value?: bigint;
@@ -1433,6 +1613,12 @@ export interface ElementsDecodeRawTransactionTxOut {
     n: number;
     scriptPubKey?: ElementsDecodeLockingScript;
     rangeproof?: string;
+    surjectionproof_offset?: number;
+    surjectionproof_size?: number;
+    surjectionproof_hash?: string;
+    rangeproof_offset?: number;
+    rangeproof_size?: number;
+    rangeproof_hash?: string;
 }
 
 /**
@@ -1568,6 +1754,48 @@ export interface ErrorResponse {
     error: InnerErrorResponse;
 }
 
+/**
+ * estimate result.
+ * @property {number} surjectionProofSize - surjection proof size of each output.
+ * @property {number[]} rangeproofSizes - rangeproof size list. (same order as amounts)
+ * @property {bigint} blindWeight - weight added by blinding all outputs. (the nonce is assumed to be set already)
+ */
+export interface EstimateBlindProofSizeData {
+    surjectionProofSize: number;
+    rangeproofSizes: number[];
+    blindWeight: bigint;
+}
+
+/**
+ * Request for estimate the blind proof sizes.
+ * @property {number} exponent? - blind exponent.
+ * @property {number} minimumBits? - blind minimum bits.
+ * @property {EstimateBlindProofSizeTransaction[]} txs - blind target transaction shape.
+ */
+export interface EstimateBlindProofSizeRequest {
+    exponent?: number;
+    minimumBits?: number;
+    txs: EstimateBlindProofSizeTransaction[];
+}
+
+/**
+ * Response of estimate the blind proof sizes.
+ * @property {EstimateBlindProofSizeData[]} txs - estimate result.
+ */
+export interface EstimateBlindProofSizeResponse {
+    txs: EstimateBlindProofSizeData[];
+}
+
+/**
+ * blind target transaction shape.
+ * @property {number} surjectionInputCount - surjection proof input count (txin count).
+ * @property {bigint | number[]} amounts - satoshi amount list of the blind target outputs. If 0, the amount is assumed to fit in minimumBits.
+ */
+export interface EstimateBlindProofSizeTransaction {
+    surjectionInputCount: number;
+    amounts: bigint | number[];
+}
+
 /**
  * Request for estimate fee
  * @property {SelectUtxoData[]} selectUtxos? - Select utxo
@@ -1604,6 +1832,90 @@ export interface EstimateFeeResponse {
     utxoFeeAmount?: bigint;
 }
 
+/**
+ * txin shape
+ * @property {string} descriptor? - output descriptor. If set, type, requireNum and pubkeyNum are taken from it.
+ * @property {string} type? - input script type. (p2pkh, p2sh, p2wpkh, p2sh-p2wpkh, p2wsh, p2sh-p2wsh, taproot, tapscript)
+ * @property {number} requireNum? - signature count (multisig or tapscript).
+ * @property {number} pubkeyNum? - pubkey count (multisig or tapscript).
+ * @property {number} redeemScriptSize? - redeem script (or tapscript) size. If 0, the multisig script size is used.
+ * @property {number} tapLeafDepth? - tapscript leaf depth (control block path count).
+ * @property {number} count? - number of the same inputs.
+ */
+export interface EstimateSizeInputData {
+    descriptor?: string;
+    type?: string;
+    requireNum?: number;
+    pubkeyNum?: number;
+    redeemScriptSize?: number;
+    tapLeafDepth?: number;
+    count?: number;
+}
+
+/**
+ * txout shape
+ * @property {string} type? - output script type. If empty, lockingScriptSize is used. (p2pkh, p2sh, p2wpkh, p2wsh, taproot, fee)
+ * @property {number} lockingScriptSize? - locking script size.
+ * @property {boolean} isBlind? - blind target flag. (This field is available only elements.)
+ * @property {bigint | number} amount? - satoshi amount. If 0, the amount is assumed to fit in minimumBits. (This field is available only elements.)
+ * @property {number} count? - number of the same outputs.
+ */
+export interface EstimateSizeOutputData {
+    type?: string;
+    lockingScriptSize?: number;
+    isBlind?: boolean;
+    amount?: bigint | number;
+    count?: number;
+}
+
+/**
+ * candidate transaction shape
+ * @property {number} surjectionInputCount? - surjection proof input count. If 0, the txin count is used. (This field is available only elements.)
+ * @property {EstimateSizeInputData[]} inputs? - txin shape
+ * @property {EstimateSizeOutputData[]} outputs? - txout shape
+ */
+export interface EstimateTransactionSizeCandidate {
+    surjectionInputCount?: number;
+    inputs?: EstimateSizeInputData[];
+    outputs?: EstimateSizeOutputData[];
+}
+
+/**
+ * estimate result
+ * @property {bigint} weight - transaction weight
+ * @property {bigint} vsize - transaction vsize
+ * @property {bigint} feeAmount - fee amount
+ */
+export interface EstimateTransactionSizeData {
+    weight: bigint;
+    vsize: bigint;
+    feeAmount: bigint;
+}
+
+/**
+ * Request for estimate transaction size.
+ * @property {boolean} isElements? - elements transaction flag.
+ * @property {number} feeRate - network fee rate (satoshi per vbyte)
+ * @property {number} exponent? - blind exponent. (This field is available only elements.)
+ * @property {number} minimumBits? - blind minimum bits. (This field is available only elements.)
+ * @property {EstimateTransactionSizeCandidate[]} candidates - candidate transaction shape
+ */
+export interface EstimateTransactionSizeRequest {
+    isElements?: boolean;
+    feeRate: number;
+    exponent?: number;
+    minimumBits?: number;
+    candidates: EstimateTransactionSizeCandidate[];
+}
+
+/**
+ * Response of estimate transaction size.
+ * @property {EstimateTransactionSizeData[]} results - estimate result
+ */
+export interface EstimateTransactionSizeResponse {
+    results: EstimateTransactionSizeData[];
+}
+
 /**
  * Request for extract secret data on ecdsa adaptor.
  * @property {string} adaptorSignature - adaptor signature hex.
@@ -1741,7 +2053,8 @@ export interface FundPsbtResponse {
 
 /**
  * Request data for fund transaction.
- * @property {FundUtxoJsonData[]} utxos - utxo data.
+ * @property {FundUtxoJsonData[]} utxos? - utxo data.
+ * @property {number} utxoPoolId? - utxo pool id. If set, unlocked utxos in the pool are used instead of utxos. It cannot be set with utxos.
  * @property {FundSelectUtxoData[]} selectUtxos? - Txin's utxo data.
  * @property {string} tx - transaction hex
  * @property {boolean} isElements? - elements transaction flag. (require when you set the transaction field)
@@ -1752,7 +2065,8 @@ export interface FundPsbtResponse {
  * @property {FundFeeInformation} feeInfo? - fee information
  */
 export interface FundRawTransactionRequest {
-    utxos: FundUtxoJsonData[];
+    utxos?: FundUtxoJsonData[];
+    utxoPoolId?: number;
     selectUtxos?: FundSelectUtxoData[];
     tx: string;
     isElements?: boolean;
@@ -1907,6 +2221,22 @@ export interface GetCommitmentResponse {
     amountCommitment: string;
 }
 
+/**
+ * Request for get commitments.
+ * @property {CommitmentTarget[]} targets - commitment target data.
+ */
+export interface GetCommitmentsRequest {
+    targets: CommitmentTarget[];
+}
+
+/**
+ * Response of get commitments.
+ * @property {CommitmentData[]} commitments - commitment data.
+ */
+export interface GetCommitmentsResponse {
+    commitments: CommitmentData[];
+}
+
 /**
  * Request for get confidential address.
  * @property {string} unblindedAddress - unblinded address
@@ -1925,6 +2255,26 @@ export interface GetConfidentialAddressResponse {
     confidentialAddress: string;
 }
 
+/**
+ * Request for get default blinding keys.
+ * @property {string} masterBlindingKey - master blinding key
+ * @property {string[]} lockingScripts - locking script list
+ * @property {boolean} useCache? - reuse the blinding key of the same locking script in this request.
+ */
+export interface GetDefaultBlindingKeyBatchRequest {
+    masterBlindingKey: string;
+    lockingScripts: string[];
+    useCache?: boolean;
+}
+
+/**
+ * Response of blinding keys.
+ * @property {string[]} blindingKeys - blinding key list. (same order as lockingScripts)
+ */
+export interface GetDefaultBlindingKeyBatchResponse {
+    blindingKeys: string[];
+}
+
 /**
  * Request for get default blinding key.
  * @property {string} masterBlindingKey - master blinding key
@@ -1986,6 +2336,20 @@ export interface GetIssuanceBlindingKeyRequest {
     vout: number;
 }
 
+/**
+ * Response for locking script resolution cache information.
+ * @property {bigint} capacity - max entry count
+ * @property {bigint} size - current entry count
+ * @property {bigint} hitCount - cache hit count
+ * @property {bigint} missCount - cache miss count
+ */
+export interface GetLockingScriptCacheInfoResponse {
+    capacity: bigint;
+    size: bigint;
+    hitCount: bigint;
+    missCount: bigint;
+}
+
 /**
  * Request for get mnemonic word list
  * @property {string} language - mnemonic language (support [en es fr it jp zhs zht])
@@ -2052,6 +2416,28 @@ export interface GetSchnorrPubkeyFromPrivkeyRequest {
     privkey: string;
 }
 
+/**
+ * Request for get signature hashes.
+ * @property {string} tx - transaction hex
+ * @property {boolean} isElements? - elements transaction flag.
+ * @property {GetSighashTxIn[]} txins - txin data
+ * @property {UtxoObject[]} utxos - UTXO data.
+ */
+export interface GetSighashesRequest {
+    tx: string;
+    isElements?: boolean;
+    txins: GetSighashTxIn[];
+    utxos: UtxoObject[];
+}
+
+/**
+ * Response of get signature hashes.
+ * @property {SighashData[]} sighashes - sighash data.
+ */
+export interface GetSighashesResponse {
+    sighashes: SighashData[];
+}
+
 /**
  * Request for get signature hash.
  * @property {string} tx - transaction hex
@@ -2315,6 +2701,18 @@ export interface IssuanceDataResponse {
     token?: string;
 }
 
+/**
+ * Request for lock utxos in the utxo pool.
+ * @property {number} poolId - utxo pool id.
+ * @property {OutPoint[]} outpoints - OutPoint data.
+ * @property {boolean} isLock? - true is lock, false is unlock. Locked utxos are not selected.
+ */
+export interface LockUtxoPoolItemsRequest {
+    poolId: number;
+    outpoints: OutPoint[];
+    isLock?: boolean;
+}
+
 /**
  * OutPoint data.
  * @property {string} txid - utxo txid.
@@ -2696,6 +3094,116 @@ export interface ReissuanceDataRequest {
     isRemoveNonce?: boolean;
 }
 
+/**
+ * Request for remove utxos from the utxo pool.
+ * @property {number} poolId - utxo pool id.
+ * @property {OutPoint[]} outpoints - OutPoint data.
+ */
+export interface RemoveUtxoPoolItemsRequest {
+    poolId: number;
+    outpoints: OutPoint[];
+}
+
+/**
+ * Request data for re-selecting utxos at a new fee rate.
+ * @property {UtxoJsonData[]} utxos? - utxo data.
+ * @property {number} utxoPoolId? - utxo pool id. If set, unlocked utxos in the pool are used instead of utxos. It cannot be set with utxos.
+ * @property {UtxoJsonData[]} previousUtxos - utxo data.
+ * @property {string} selectionState? - selection state of the previous selection. (SelectUtxos or ReselectUtxos) (It must match previousUtxos. If the previous fee asset selection has no change, a changeless extension is searched by BnB first. The txin sizes of previousUtxos are taken from it.)
+ * @property {boolean} isElements? - elements transaction flag.
+ * @property {bigint | number} targetAmount? - Amount more than the specified amount is set in txout. default is 0 (disable). (This field is available only bitcoin.)
+ * @property {TargetAmountMapData[]} targets? - target amount data.
+ * @property {CoinSelectionFeeInformationField} feeInfo? - fee information of the new fee rate.
+ * @property {BnbSearchOption} bnbOption? - BnB search option. (This field is used only the full search.)
+ */
+export interface ReselectUtxosRequest {
+    utxos?: UtxoJsonData[];
+    utxoPoolId?: number;
+    previousUtxos: UtxoJsonData[];
+    selectionState?: string;
+    isElements?: boolean;
+    targetAmount?: bigint | number;
+    targets?: TargetAmountMapData[];
+    feeInfo?: CoinSelectionFeeInformationField;
+    bnbOption?: BnbSearchOption;
+}
+
+/**
+ * Response data of re-selecting utxos.
+ * @property {UtxoJsonData[]} utxos - utxo list. (previous utxos and added utxos)
+ * @property {UtxoJsonData[]} addedUtxos - utxo list added to the previous utxos.
+ * @property {bigint} selectedAmount? - selected amount.
+ * @property {TargetAmountMapData[]} selectedAmounts? - target amount data.
+ * @property {bigint} feeAmount? - fee amount.
+ * @property {bigint} utxoFeeAmount - utxo's fee amount.
+ * @property {boolean} isFullSearch - true if the previous utxos could not be extended and all utxos were searched again.
+ * @property {string} selectionState - opaque selection state for the next ReselectUtxos.
+ */
+export interface ReselectUtxosResponse {
+    utxos: UtxoJsonData[];
+    addedUtxos: UtxoJsonData[];
+    selectedAmount?: bigint;
+    selectedAmounts?: TargetAmountMapData[];
+    feeAmount?: bigint;
+    utxoFeeAmount: bigint;
+    isFullSearch: boolean;
+    selectionState: string;
+}
+
+/**
+ * Request for scanning and unblinding transactions.
+ * @property {string[]} txs - transaction hex list.
+ * @property {ScanUnblindScript[]} scripts - wallet script data.
+ * @property {string} masterBlindingKey? - SLIP77 master blinding key.
+ * @property {number} threadCount? - unblinding thread count. (0: hardware threads)
+ */
+export interface ScanAndUnblindRequest {
+    txs: string[];
+    scripts: ScanUnblindScript[];
+    masterBlindingKey?: string;
+    threadCount?: number;
+}
+
+/**
+ * The unblinded outputs of the wallet scripts.
+ * @property {ScanUnblindOutput[]} outputs - unblinded output data.
+ */
+export interface ScanAndUnblindResponse {
+    outputs: ScanUnblindOutput[];
+}
+
+/**
+ * unblinded output data.
+ * @property {string} txid - txid
+ * @property {number} index - vout
+ * @property {string} lockingScript - locking script
+ * @property {string} asset - asset
+ * @property {bigint} amount - satoshi amount
+ * @property {string} blindFactor - amount blind factor. (zero if the output is not blinded)
+ * @property {string} assetBlindFactor - asset blind factor. (zero if the output is not blinded)
+ */
+export interface ScanUnblindOutput {
+    txid: string;
+    index: number;
+    lockingScript: string;
+    asset: string;
+    amount: bigint;
+    blindFactor: string;
+    assetBlindFactor: string;
+}
+
+/**
+ * wallet script data.
+ * @property {string} address? - address. (confidential or unconfidential)
+ * @property {string} lockingScript? - locking script. Use instead of address.
+ * @property {string} blindingKey? - blinding key. If empty, the key is derived from masterBlindingKey.
+ */
+export interface ScanUnblindScript {
+    address?: string;
+    lockingScript?: string;
+    blindingKey?: string;
+}
+
 /**
  * schnorr pubkey data.
  * @property {string} pubkey - schnorr public key
@@ -2796,20 +3304,84 @@ export interface SelectUtxoData {
     scriptSigTemplate?: string;
 }
 
+/**
+ * payout target data.
+ * @property {bigint | number} targetAmount? - Amount more than the specified amount is set in txout. default is 0 (disable). (This field is available only bitcoin.)
+ * @property {TargetAmountMapData[]} targets? - target amount data.
+ */
+export interface SelectUtxosBatchPayout {
+    targetAmount?: bigint | number;
+    targets?: TargetAmountMapData[];
+}
+
+/**
+ * Request data for selecting utxos of many payouts.
+ * @property {UtxoJsonData[]} utxos? - utxo data.
+ * @property {number} utxoPoolId? - utxo pool id. If set, unlocked utxos in the pool are used instead of utxos. It cannot be set with utxos.
+ * @property {boolean} lockSelectedUtxos? - lock the selected utxos in the utxo pool. (This field is available only utxoPoolId is set.)
+ * @property {boolean} isElements? - elements transaction flag.
+ * @property {SelectUtxosBatchPayout[]} payouts - payout target data.
+ * @property {CoinSelectionFeeInformationField} feeInfo? - fee information.
+ * @property {BnbSearchOption} bnbOption? - BnB search option.
+ */
+export interface SelectUtxosBatchRequest {
+    utxos?: UtxoJsonData[];
+    utxoPoolId?: number;
+    lockSelectedUtxos?: boolean;
+    isElements?: boolean;
+    payouts: SelectUtxosBatchPayout[];
+    feeInfo?: CoinSelectionFeeInformationField;
+    bnbOption?: BnbSearchOption;
+}
+
+/**
+ * Response data of selecting utxos of many payouts.
+ * @property {SelectUtxosBatchResult[]} results - selected data of the payout.
+ * @property {bigint} totalFeeAmount - total fee amount of all payouts.
+ */
+export interface SelectUtxosBatchResponse {
+    results: SelectUtxosBatchResult[];
+    totalFeeAmount: bigint;
+}
+
+/**
+ * selected data of the payout.
+ * @property {UtxoJsonData[]} utxos - utxo list.
+ * @property {bigint} selectedAmount? - selected amount.
+ * @property {TargetAmountMapData[]} selectedAmounts? - target amount data.
+ * @property {bigint} feeAmount? - fee amount.
+ * @property {bigint} utxoFeeAmount - utxo's fee amount.
+ */
+export interface SelectUtxosBatchResult {
+    utxos: UtxoJsonData[];
+    selectedAmount?: bigint;
+    selectedAmounts?: TargetAmountMapData[];
+    feeAmount?: bigint;
+    utxoFeeAmount: bigint;
+}
+
 /**
  * Request data for selecting utxo.
- * @property {UtxoJsonData[]} utxos - utxo data.
+ * @property {UtxoJsonData[]} utxos? - utxo data.
+ * @property {number} utxoPoolId? - utxo pool id. If set, unlocked utxos in the pool are used instead of utxos. It cannot be set with utxos.
  * @property {bigint | number} targetAmount? - Amount more than the specified amount is set in txout. default is 0 (disable). (This field is available only bitcoin.)
  * @property {boolean} isElements? - elements transaction flag.
  * @property {TargetAmountMapData[]} targets? - target amount data.
  * @property {CoinSelectionFeeInformationField} feeInfo? - fee information.
+ * @property {string} selectionMode? - coin selection engine. (default: cfd coin selection, columnar: structure-of-arrays selection engine.)
+ * @property {boolean} parallelAssetSelection? - select the assets other than the fee asset concurrently. (This field is available only elements and columnar selectionMode.)
+ * @property {BnbSearchOption} bnbOption? - BnB search option. (This field is available only columnar selectionMode.)
  */
 export interface SelectUtxosRequest {
-    utxos: UtxoJsonData[];
+    utxos?: UtxoJsonData[];
+    utxoPoolId?: number;
     targetAmount?: bigint | number;
     isElements?: boolean;
     targets?: TargetAmountMapData[];
     feeInfo?: CoinSelectionFeeInformationField;
+    selectionMode?: string;
+    parallelAssetSelection?: boolean;
+    bnbOption?: BnbSearchOption;
 }
 
 /**
@@ -2819,6 +3391,8 @@ export interface SelectUtxosRequest {
  * @property {TargetAmountMapData[]} selectedAmounts? - target amount data.
  * @property {bigint} feeAmount? - fee amount. (This field is available only searched by BnB algorithm.)
  * @property {bigint} utxoFeeAmount - utxo's fee amount.
+ * @property {BnbSearchStatistics} bnbStatistics? - BnB search statistics. (This field is available only columnar selectionMode.)
+ * @property {string} selectionState? - opaque selection state for ReselectUtxos. (This field is available only columnar selectionMode. It has the selected outpoints, their txin sizes and whether the fee asset was selected without a change by BnB.)
  */
 export interface SelectUtxosResponse {
     utxos: UtxoJsonData[];
@@ -2826,6 +3400,8 @@ export interface SelectUtxosResponse {
     selectedAmounts?: TargetAmountMapData[];
     feeAmount?: bigint;
     utxoFeeAmount: bigint;
+    bnbStatistics?: BnbSearchStatistics;
+    selectionState?: string;
 }
 
 /**
@@ -2888,6 +3464,50 @@ export interface SetPsbtRequest {
     global?: PsbtGlobalRequestData;
 }
 
+/**
+ * Request for set issuances of many transactions.
+ * @property {SetRawIssuanceRequest[]} requests - Request for set issuances of a transaction.
+ * @property {number} threadCount? - thread count. (0: hardware threads)
+ */
+export interface SetRawIssuanceBatchRequest {
+    requests: SetRawIssuanceRequest[];
+    threadCount?: number;
+}
+
+/**
+ * Response of set issuances of many transactions.
+ * @property {SetRawIssuanceResponse[]} results - Response of set issuances of a transaction.
+ */
+export interface SetRawIssuanceBatchResponse {
+    results: SetRawIssuanceResponse[];
+}
+
+/**
+ * Request for set issuances of a transaction.
+ * @property {string} tx - transaction hex
+ * @property {boolean} isRandomSortTxOut? - txout random sort after adding transaction
+ * @property {IssuanceDataRequest[]} issuances? - issuance data
+ * @property {ReissuanceDataRequest[]} reissuances? - reissuance txin data
+ */
+export interface SetRawIssuanceRequest {
+    tx: string;
+    isRandomSortTxOut?: boolean;
+    issuances?: IssuanceDataRequest[];
+    reissuances?: ReissuanceDataRequest[];
+}
+
+/**
+ * Response of set issuances of a transaction.
+ * @property {string} hex - transaction hex
+ * @property {IssuanceDataResponse[]} issuances - issuance data
+ * @property {IssuanceDataResponse[]} reissuances - issuance data
+ */
+export interface SetRawIssuanceResponse {
+    hex: string;
+    issuances: IssuanceDataResponse[];
+    reissuances: IssuanceDataResponse[];
+}
+
 /**
  * Request for set issue asset.
  * @property {string} tx - transaction hex
@@ -2932,6 +3552,18 @@ export interface SetRawReissueAssetResponse {
     issuances: IssuanceDataResponse[];
 }
 
+/**
+ * sighash data.
+ * @property {string} txid - utxo txid
+ * @property {number} vout - utxo vout
+ * @property {string} sighash - sighash
+ */
+export interface SighashData {
+    txid: string;
+    vout: number;
+    sighash: string;
+}
+
 /**
  * The data containing signature.
  * @property {string} signature - signature
@@ -2985,13 +3617,19 @@ export interface SignEcdsaAdaptorResponse {
 /**
  * Sign psbt data.
  * @property {string} psbt - psbt data (hex or base64)
- * @property {string} privkey - private key. hex or wif format.
+ * @property {string} privkey? - private key. hex or wif format. (privkey, privkeys or xprv is required.)
+ * @property {string[]} privkeys? - private key list. hex or wif format. (The inputs are matched by the bip32 derivation pubkeys.)
+ * @property {string} xprv? - extended private key. (The keys are derived by the bip32 derivation records. A master xprv is matched by the master fingerprint, and any other xprv is matched by the path element at its depth.)
  * @property {boolean} hasGrindR? - grind-r option
+ * @property {number} threadCount? - signing thread count. 0 is the hardware thread count. (This field is available only privkeys or xprv is set. On wasm, signing runs on a single thread.)
  */
 export interface SignPsbtRequest {
     psbt: string;
-    privkey: string;
+    privkey?: string;
+    privkeys?: string[];
+    xprv?: string;
     hasGrindR?: boolean;
+    threadCount?: number;
 }
 
 /**
@@ -3444,6 +4082,38 @@ export interface UtxoObject {
     scriptSigTemplate?: string;
 }
 
+/**
+ * The utxo pool information.
+ * @property {number} poolId - utxo pool id.
+ * @property {number} count - utxo count in the pool.
+ * @property {number} lockedCount - locked utxo count in the pool.
+ */
+export interface UtxoPoolInfoResponse {
+    poolId: number;
+    count: number;
+    lockedCount: number;
+}
+
+/**
+ * utxo data.
+ * @property {string} txid - utxo txid.
+ * @property {number} vout - utxo vout.
+ * @property {bigint | number} amount - satoshi amount.
+ * @property {string} address? - address (This field is available only bitcoin utxo.)
+ * @property {string} asset? - asset id. (This field is available only elements utxo.)
+ * @property {string} descriptor? - output descriptor. (descriptor is required, you needs to consider fee amount)
+ * @property {string} scriptSigTemplate? - ScriptSig template is for scriptHash calculation fee.
+ */
+export interface UtxoPoolItemData {
+    txid: string;
+    vout: number;
+    amount: bigint | number;
+    address?: string;
+    asset?: string;
+    descriptor?: string;
+    scriptSigTemplate?: string;
+}
+
 /**
  * Request for verify signature
  * @property {string} adaptorSignature - adaptor signature hex.
@@ -3466,10 +4136,12 @@ export interface VerifyEcdsaAdaptorRequest {
  * Request to verify psbt sign.
  * @property {string} psbt - psbt data (hex or base64)
  * @property {OutPoint[]} outPointList? - OutPoint data.
+ * @property {number} threadCount? - verification thread count. 0 is the hardware thread count. (On wasm, verification runs on a single thread.)
  */
 export interface VerifyPsbtSignRequest {
     psbt: string;
     outPointList?: OutPoint[];
+    threadCount?: number;
 }
 
 /**
@@ -3656,6 +4328,13 @@ export function AddTaprootSchnorrSign(jsonObject: AddTaprootSchnorrSignRequest):
  */
 export function AddTapscriptSign(jsonObject: AddTapscriptSignRequest): RawTransactionResponse;
 
+/**
+ * Add utxos to the utxo pool.
+ * @param {AddUtxoPoolItemsRequest} jsonObject - request data.
+ * @return {UtxoPoolInfoResponse} - response data.
+ */
+export function AddUtxoPoolItems(jsonObject: AddUtxoPoolItemsRequest): UtxoPoolInfoResponse;
+
 /**
  * Analyze TapScript tree.
  * @param {AnalyzeTapScriptTreeRequest} jsonObject - request data.
@@ -3859,6 +4538,13 @@ export function CreatePsbt(jsonObject: CreateRawTransactionRequest): PsbtOutputD
  */
 export function CreateRawPegin(jsonObject: CreateRawPeginRequest): RawTransactionResponse;
 
+/**
+ * Create many pegin transactions.
+ * @param {CreateRawPeginBatchRequest} jsonObject - request data.
+ * @return {CreateRawPeginBatchResponse} - response data.
+ */
+export function CreateRawPeginBatch(jsonObject: CreateRawPeginBatchRequest): CreateRawPeginBatchResponse;
+
 /**
  * Create pegout transaction
  * @param {CreateRawPegoutRequest} jsonObject - request data.
@@ -3887,6 +4573,13 @@ export function CreateScript(jsonObject: CreateScriptRequest): ScriptDataRespons
  */
 export function CreateSignatureHash(jsonObject: CreateSignatureHashRequest): CreateSignatureHashResponse;
 
+/**
+ * Create the utxo pool.
+ * @param {CreateUtxoPoolRequest} jsonObject - request data.
+ * @return {UtxoPoolInfoResponse} - response data.
+ */
+export function CreateUtxoPool(jsonObject: CreateUtxoPoolRequest): UtxoPoolInfoResponse;
+
 /**
  * Decode base58.
  * @param {DecodeBase58Request} jsonObject - request data.
@@ -3921,6 +4614,20 @@ export function DecodePsbt(jsonObject: DecodePsbtRequest): DecodePsbtResponse;
  */
 export function DecodeRawTransaction(jsonObject: DecodeRawTransactionRequest): DecodeRawTransactionResponse;
 
+/**
+ * Delete the utxo pool.
+ * @param {DeleteUtxoPoolRequest} jsonObject - request data.
+ * @return {UtxoPoolInfoResponse} - response data.
+ */
+export function DeleteUtxoPool(jsonObject: DeleteUtxoPoolRequest): UtxoPoolInfoResponse;
+
+/**
+ * Apply multiple edit operations to the transaction.
+ * @param {EditRawTransactionRequest} jsonObject - request data.
+ * @return {RawTransactionResponse} - response data.
+ */
+export function EditRawTransaction(jsonObject: EditRawTransactionRequest): RawTransactionResponse;
+
 /**
  * Add raw transaction.
  * @param {ElementsAddRawTransactionRequest} jsonObject - request data.
@@ -3963,6 +4670,13 @@ export function EncodeBase64(jsonObject: HexData): Base64Data;
  */
 export function EncodeSignatureByDer(jsonObject: EncodeSignatureByDerRequest): EncodeSignatureByDerResponse;
 
+/**
+ * Estimate the proof sizes of blinded outputs.
+ * @param {EstimateBlindProofSizeRequest} jsonObject - request data.
+ * @return {EstimateBlindProofSizeResponse} - response data.
+ */
+export function EstimateBlindProofSize(jsonObject: EstimateBlindProofSizeRequest): EstimateBlindProofSizeResponse;
+
 /**
  * Estimate fee.
  * @param {EstimateFeeRequest} jsonObject - request data.
@@ -3970,6 +4684,13 @@ export function EncodeSignatureByDer(jsonObject: EncodeSignatureByDerRequest): E
  */
 export function EstimateFee(jsonObject: EstimateFeeRequest): EstimateFeeResponse;
 
+/**
+ * Estimate transaction size and fee by weight tables.
+ * @param {EstimateTransactionSizeRequest} jsonObject - request data.
+ * @return {EstimateTransactionSizeResponse} - response data.
+ */
+export function EstimateTransactionSize(jsonObject: EstimateTransactionSizeRequest): EstimateTransactionSizeResponse;
+
 /**
  * Extract secret data on ecdsa adaptor.
  * @param {ExtractSecretEcdsaAdaptorRequest} jsonObject - request data.
@@ -4033,6 +4754,13 @@ export function GetBlockInfo(jsonObject: BlockData): BlockInformation;
  */
 export function GetCommitment(jsonObject: GetCommitmentRequest): GetCommitmentResponse;
 
+/**
+ * Get many commitments.
+ * @param {GetCommitmentsRequest} jsonObject - request data.
+ * @return {GetCommitmentsResponse} - response data.
+ */
+export function GetCommitments(jsonObject: GetCommitmentsRequest): GetCommitmentsResponse;
+
 /**
  * Get compressed pubkey.
  * @param {PubkeyData} jsonObject - request data.
@@ -4054,6 +4782,13 @@ export function GetConfidentialAddress(jsonObject: GetConfidentialAddressRequest
  */
 export function GetDefaultBlindingKey(jsonObject: GetDefaultBlindingKeyRequest): BlindingKeyResponse;
 
+/**
+ * Get default blinding keys of many locking scripts.
+ * @param {GetDefaultBlindingKeyBatchRequest} jsonObject - request data.
+ * @return {GetDefaultBlindingKeyBatchResponse} - response data.
+ */
+export function GetDefaultBlindingKeyBatch(jsonObject: GetDefaultBlindingKeyBatchRequest): GetDefaultBlindingKeyBatchResponse;
+
 /**
  * Get extkey information.
  * @param {GetExtkeyInfoRequest} jsonObject - request data.
@@ -4068,6 +4803,12 @@ export function GetExtkeyInfo(jsonObject: GetExtkeyInfoRequest): GetExtkeyInfoRe
  */
 export function GetIssuanceBlindingKey(jsonObject: GetIssuanceBlindingKeyRequest): BlindingKeyResponse;
 
+/**
+ * Get locking script resolution cache information.
+ * @return {GetLockingScriptCacheInfoResponse} - response data.
+ */
+export function GetLockingScriptCacheInfo(): GetLockingScriptCacheInfoResponse;
+
 /**
  * Get mnemonic word list
  * @param {GetMnemonicWordlistRequest} jsonObject - request data.
@@ -4138,6 +4879,13 @@ export function GetSchnorrPubkeyFromPubkey(jsonObject: PubkeyData): SchnorrPubke
  */
 export function GetSighash(jsonObject: GetSighashRequest): CreateSignatureHashResponse;
 
+/**
+ * Get signature hashes of multiple txins.
+ * @param {GetSighashesRequest} jsonObject - request data.
+ * @return {GetSighashesResponse} - response data.
+ */
+export function GetSighashes(jsonObject: GetSighashesRequest): GetSighashesResponse;
+
 /**
  * Get supported function.
  * @return {GetSupportedFunctionResponse} - response data.
@@ -4242,6 +4990,13 @@ export function IsFinalizedPsbt(jsonObject: IsFinalizedPsbtRequest): IsFinalized
  */
 export function JoinPsbts(jsonObject: PsbtList): PsbtOutputData;
 
+/**
+ * Lock or unlock utxos in the utxo pool.
+ * @param {LockUtxoPoolItemsRequest} jsonObject - request data.
+ * @return {UtxoPoolInfoResponse} - response data.
+ */
+export function LockUtxoPoolItems(jsonObject: LockUtxoPoolItemsRequest): UtxoPoolInfoResponse;
+
 /**
  * Negate privkey.
  * @param {PrivkeyData} jsonObject - request data.
@@ -4270,6 +5025,27 @@ export function ParseDescriptor(jsonObject: ParseDescriptorRequest): ParseDescri
  */
 export function ParseScript(jsonObject: ParseScriptRequest): ParseScriptResponse;
 
+/**
+ * Remove utxos from the utxo pool.
+ * @param {RemoveUtxoPoolItemsRequest} jsonObject - request data.
+ * @return {UtxoPoolInfoResponse} - response data.
+ */
+export function RemoveUtxoPoolItems(jsonObject: RemoveUtxoPoolItemsRequest): UtxoPoolInfoResponse;
+
+/**
+ * Re-select coins at a new fee rate from the previous selection.
+ * @param {ReselectUtxosRequest} jsonObject - request data.
+ * @return {ReselectUtxosResponse} - response data.
+ */
+export function ReselectUtxos(jsonObject: ReselectUtxosRequest): ReselectUtxosResponse;
+
+/**
+ * scan transactions and unblind the outputs of the wallet scripts.
+ * @param {ScanAndUnblindRequest} jsonObject - request data.
+ * @return {ScanAndUnblindResponse} - response data.
+ */
+export function ScanAndUnblind(jsonObject: ScanAndUnblindRequest): ScanAndUnblindResponse;
+
 /**
  * Create a Schnorr signature for a given message
  * @param {SchnorrSignRequest} jsonObject - request data.
@@ -4291,6 +5067,13 @@ export function SchnorrVerify(jsonObject: SchnorrVerifyRequest): SchnorrVerifyRe
  */
 export function SelectUtxos(jsonObject: SelectUtxosRequest): SelectUtxosResponse;
 
+/**
+ * Select coins of many payouts.
+ * @param {SelectUtxosBatchRequest} jsonObject - request data.
+ * @return {SelectUtxosBatchResponse} - response data.
+ */
+export function SelectUtxosBatch(jsonObject: SelectUtxosBatchRequest): SelectUtxosBatchResponse;
+
 /**
  * Serialize to ledger format.
  * @param {SerializeLedgerFormatRequest} jsonObject - request data.
@@ -4312,6 +5095,13 @@ export function SetPsbtData(jsonObject: SetPsbtRequest): PsbtOutputData;
  */
 export function SetPsbtRecord(jsonObject: SetPsbtRecordRequest): PsbtOutputData;
 
+/**
+ * Set issue and reissue asset to many transactions concurrently.
+ * @param {SetRawIssuanceBatchRequest} jsonObject - request data.
+ * @return {SetRawIssuanceBatchResponse} - response data.
+ */
+export function SetRawIssuanceBatch(jsonObject: SetRawIssuanceBatchRequest): SetRawIssuanceBatchResponse;
+
 /**
  * Set issue asset.
  * @param {SetRawIssueAssetRequest} jsonObject - request data.
@@ -0,0 +1,528 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_bench_coinselect.cpp
+ *
+ * @brief Coin selection benchmark over synthetic wallets.
+ *
+ * usage: cfdjs_bench_coinselect [--sizes=1000,10000,100000]
+ *     [--iterations=50] [--seed=1] [--api=select,columnar,fund,psbt]
+ *     [--network=bitcoin,elements] [--source=request|pool]
+ *
+ * All apis of a run take the utxos from the same source, so their
+ * latencies are comparable. FundPsbt has no utxo pool support, so the psbt
+ * api is skipped on the pool source.
+ */
+#include <algorithm>
+#include <chrono>  // NOLINT
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cfdjs/cfdjs_api_json.h"
+
+using cfd::js::api::json::JsonMappingApi;
+
+//! utxo descriptor
+static const char kDescriptor[] =
+    "wpkh([ef735203/0'/0'/7']"
+    "022c2409fbf657ba25d97bb3dab5426d20677b774d4fc7bd3bfac27ff96ada3dd1)";
+//! bitcoin payment address
+static const char kBitcoinAddress[] =
+    "bcrt1q4akzjg7phc3n3cmcu6n2r73gr2slgugm7w8z3v";
+//! bitcoin change address
+static const char kBitcoinReserveAddress[] =
+    "bcrt1qa77w63m523kq82z4fn3d5f7qxqxfm4pmdthkdf";
+//! elements payment address
+static const char kElementsAddress[] =
+    "ex1q0r4elskfu8xlvvlvkergtzagv2ep8p9ttsns6q";
+//! elements change address
+static const char kElementsReserveAddress[] =
+    "ex1q0r4elskfu8xlvvlvkergtzagv2ep8p9ttsns6q";
+//! elements fee asset
+static const char kElementsAsset[] =
+    "aa00000000000000000000000000000000000000000000000000000000000000";
+
+//! effective fee rate (satoshi/vbyte)
+static constexpr double kFeeRate = 20;
+//! long-term fee rate (satoshi/vbyte)
+static constexpr double kLongTermFeeRate = 10;
+//! change output + change input vsize (bitcoin p2wpkh)
+static constexpr int64_t kBitcoinChangeVsize = 31 + 68;
+//! change output + change input vsize (elements unblinded p2wpkh)
+static constexpr int64_t kElementsChangeVsize = 45 + 69;
+//! utxo count of one AddUtxoPoolItems call
+static constexpr size_t kPoolChunkSize = 10000;
+
+/**
+ * @brief Utxo amount distribution.
+ */
+enum class Distribution {
+  kUniform,   //!< uniform
+  kPowerLaw,  //!< pareto (many small, few large)
+  kDustHeavy  //!< mostly dust, some large
+};
+
+/**
+ * @brief Benchmark option.
+ */
+struct BenchOption {
+  std::vector<size_t> sizes = {1000, 10000, 100000};  //!< utxo counts
+  uint32_t iterations = 50;                           //!< calls per case
+  uint64_t seed = 1;                                  //!< random seed
+  std::vector<std::string> apis = {"select", "columnar", "fund", "psbt"};
+  std::vector<std::string> networks = {"bitcoin", "elements"};
+  std::string source = "request";  //!< utxo source (request, pool)
+};
+
+/**
+ * @brief Benchmark measurement of one case.
+ */
+struct BenchResult {
+  std::vector<double> latencies;  //!< call latency (msec)
+  uint32_t changeless_count = 0;  //!< changeless solution count
+  uint32_t error_count = 0;       //!< error response count
+  int64_t total_fee = 0;          //!< total fee
+  int64_t total_waste = 0;        //!< total waste (select only)
+  bool has_waste = false;         //!< waste is measured
+};
+
+/**
+ * @brief Split a comma separated list.
+ * @param[in] text    text
+ * @return list
+ */
+static std::vector<std::string> SplitList(const std::string& text) {
+  std::vector<std::string> result;
+  size_t start = 0;
+  while (start <= text.size()) {
+    size_t end = text.find(',', start);
+    if (end == std::string::npos) end = text.size();
+    if (end > start) result.push_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+  return result;
+}
+
+/**
+ * @brief Find a number field in a json string.
+ * @param[in] json      json string
+ * @param[in] key       field name
+ * @param[in] start     search start position
+ * @param[out] value    number value
+ * @retval true   found
+ * @retval false  not found
+ */
+static bool FindJsonNumber(
+    const std::string& json, const std::string& key, size_t start,
+    int64_t* value) {
+  std::string pattern = "\"" + key + "\":";
+  size_t pos = json.find(pattern, start);
+  if (pos == std::string::npos) return false;
+  *value = std::strtoll(json.c_str() + pos + pattern.size(), nullptr, 10);
+  return true;
+}
+
+/**
+ * @brief Generate utxo amounts.
+ * @param[in] size          utxo count
+ * @param[in] distribution  amount distribution
+ * @param[in,out] random    random engine
+ * @return amount list
+ */
+static std::vector<int64_t> GenerateAmounts(
+    size_t size, Distribution distribution, std::mt19937_64* random) {
+  std::vector<int64_t> amounts(size);
+  std::uniform_int_distribution<int64_t> uniform(10000, 10000000);
+  std::uniform_int_distribution<int64_t> dust(546, 5000);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  for (auto& amount : amounts) {
+    switch (distribution) {
+      case Distribution::kUniform:
+        amount = uniform(*random);
+        break;
+      case Distribution::kPowerLaw: {
+        double pareto = 10000.0 / std::pow(1.0 - unit(*random), 1.0 / 1.2);
+        amount = static_cast<int64_t>(std::min(pareto, 1000000000.0));
+        break;
+      }
+      case Distribution::kDustHeavy:
+      default:
+        amount = (unit(*random) < 0.7) ? dust(*random) : uniform(*random);
+        break;
+    }
+  }
+  return amounts;
+}
+
+/**
+ * @brief Create the utxo json list.
+ * @param[in] amounts       amount list
+ * @param[in] is_elements   elements utxo flag
+ * @return utxo json list (without brackets)
+ */
+static std::vector<std::string> CreateUtxoJsonList(
+    const std::vector<int64_t>& amounts, bool is_elements) {
+  std::vector<std::string> result;
+  result.reserve(amounts.size());
+  char txid[65];
+  for (size_t index = 0; index < amounts.size(); ++index) {
+    std::snprintf(
+        txid, sizeof(txid), "%064" PRIx64, static_cast<uint64_t>(index + 1));
+    std::string json = "{\"txid\":\"" + std::string(txid) +
+                       "\",\"vout\":0,\"amount\":" +
+                       std::to_string(amounts[index]) + ",\"descriptor\":\"" +
+                       kDescriptor + "\"";
+    if (is_elements) {
+      json += ",\"asset\":\"" + std::string(kElementsAsset) + "\"";
+    }
+    result.push_back(json + "}");
+  }
+  return result;
+}
+
+/**
+ * @brief Join json list items.
+ * @param[in] list    json list
+ * @param[in] begin   begin index
+ * @param[in] end     end index
+ * @return json array
+ */
+static std::string JoinJsonList(
+    const std::vector<std::string>& list, size_t begin, size_t end) {
+  std::string result = "[";
+  for (size_t index = begin; index < end; ++index) {
+    if (index != begin) result += ",";
+    result += list[index];
+  }
+  return result + "]";
+}
+
+/**
+ * @brief Get the fee information json.
+ * @param[in] is_elements   elements flag
+ * @return fee information json
+ */
+static std::string GetFeeInfoJson(bool is_elements) {
+  std::string json = "{\"feeRate\":" + std::to_string(kFeeRate) +
+                     ",\"longTermFeeRate\":" +
+                     std::to_string(kLongTermFeeRate);
+  if (is_elements) {
+    json += ",\"feeAsset\":\"" + std::string(kElementsAsset) +
+            "\",\"isBlindEstimateFee\":false";
+  }
+  return json + "}";
+}
+
+/**
+ * @brief Create a transaction template paying the target.
+ * @param[in] is_elements   elements flag
+ * @param[in] target        target amount
+ * @return transaction hex
+ */
+static std::string CreateTxTemplate(bool is_elements, int64_t target) {
+  std::string response;
+  if (!is_elements) {
+    response = JsonMappingApi::CreateRawTransaction(
+        "{\"version\":2,\"locktime\":0,\"txins\":[],\"txouts\":[{"
+        "\"address\":\"" +
+        std::string(kBitcoinAddress) +
+        "\",\"amount\":" + std::to_string(target) + "}]}");
+  } else {
+    response = JsonMappingApi::ElementsCreateRawTransaction(
+        "{\"version\":2,\"locktime\":0,\"txins\":[],\"txouts\":[{"
+        "\"address\":\"" +
+        std::string(kElementsAddress) + "\",\"amount\":" +
+        std::to_string(target) + ",\"asset\":\"" + kElementsAsset +
+        "\"}],\"fee\":{\"amount\":0,\"asset\":\"" + kElementsAsset + "\"}}");
+  }
+  size_t pos = response.find("\"hex\":\"");
+  if (pos == std::string::npos) return "";
+  pos += 7;
+  return response.substr(pos, response.find('"', pos) - pos);
+}
+
+/**
+ * @brief Create a psbt template paying the target.
+ * @param[in] target        target amount
+ * @return psbt base64
+ */
+static std::string CreatePsbtTemplate(int64_t target) {
+  std::string response = JsonMappingApi::CreatePsbt(
+      "{\"version\":2,\"locktime\":0,\"txins\":[],\"txouts\":[{"
+      "\"address\":\"" +
+      std::string(kBitcoinAddress) +
+      "\",\"amount\":" + std::to_string(target) + "}]}");
+  size_t pos = response.find("\"psbt\":\"");
+  if (pos == std::string::npos) return "";
+  pos += 8;
+  return response.substr(pos, response.find('"', pos) - pos);
+}
+
+/**
+ * @brief Create the utxo pool.
+ * @param[in] utxo_list     utxo json list
+ * @param[in] is_elements   elements flag
+ * @return pool id (0: error)
+ */
+static int64_t CreatePool(
+    const std::vector<std::string>& utxo_list, bool is_elements) {
+  int64_t pool_id = 0;
+  std::string response = JsonMappingApi::CreateUtxoPool(
+      std::string("{\"isElements\":") + (is_elements ? "true" : "false") +
+      "}");
+  if (!FindJsonNumber(response, "poolId", 0, &pool_id)) return 0;
+  for (size_t begin = 0; begin < utxo_list.size(); begin += kPoolChunkSize) {
+    size_t end = std::min(begin + kPoolChunkSize, utxo_list.size());
+    response = JsonMappingApi::AddUtxoPoolItems(
+        "{\"poolId\":" + std::to_string(pool_id) +
+        ",\"utxos\":" + JoinJsonList(utxo_list, begin, end) + "}");
+    if (response.find("\"error\"") != std::string::npos) return 0;
+  }
+  return pool_id;
+}
+
+/**
+ * @brief Run one benchmark case.
+ * @param[in] api           api name
+ * @param[in] is_elements   elements flag
+ * @param[in] utxo_field    utxo source field (utxos or utxoPoolId)
+ * @param[in] targets       target amount list
+ * @return measurement
+ */
+static BenchResult RunCase(
+    const std::string& api, bool is_elements, const std::string& utxo_field,
+    const std::vector<int64_t>& targets) {
+  BenchResult result;
+  const std::string fee_info = GetFeeInfoJson(is_elements);
+  const int64_t change_cost = static_cast<int64_t>(std::ceil(
+      (is_elements ? kElementsChangeVsize : kBitcoinChangeVsize) * kFeeRate));
+  const std::string network = is_elements ? "liquidv1" : "regtest";
+
+  for (int64_t target : targets) {
+    // templates are created outside of the measurement.
+    std::string request;
+    if ((api == "select") || (api == "columnar")) {
+      request = "{" + utxo_field + ",\"feeInfo\":" + fee_info;
+      if (is_elements) {
+        request += ",\"isElements\":true,\"targets\":[{\"asset\":\"" +
+                   std::string(kElementsAsset) +
+                   "\",\"amount\":" + std::to_string(target) + "}]";
+      } else {
+        request += ",\"targetAmount\":" + std::to_string(target);
+      }
+      if (api == "columnar") request += ",\"selectionMode\":\"columnar\"";
+      request += "}";
+    } else if (api == "fund") {
+      request = "{" + utxo_field + ",\"tx\":\"" +
+                CreateTxTemplate(is_elements, target) + "\",\"network\":\"" +
+                network + "\",\"feeInfo\":" + fee_info;
+      if (is_elements) {
+        request += ",\"isElements\":true,\"targets\":[{\"asset\":\"" +
+                   std::string(kElementsAsset) +
+                   "\",\"amount\":0,\"reserveAddress\":\"" +
+                   kElementsReserveAddress + "\"}]}";
+      } else {
+        request += ",\"reserveAddress\":\"" +
+                   std::string(kBitcoinReserveAddress) + "\"}";
+      }
+    } else {
+      request = "{" + utxo_field + ",\"psbt\":\"" +
+                CreatePsbtTemplate(target) + "\",\"network\":\"" + network +
+                "\",\"reservedDescriptor\":\"" + kDescriptor +
+                "\",\"feeInfo\":" + fee_info + "}";
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::string response;
+    if ((api == "select") || (api == "columnar")) {
+      response = JsonMappingApi::SelectUtxos(request);
+    } else if (api == "fund") {
+      response = JsonMappingApi::FundRawTransaction(request);
+    } else {
+      response = JsonMappingApi::FundPsbt(request);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    result.latencies.push_back(
+        std::chrono::duration<double, std::milli>(elapsed).count());
+
+    if (response.find("\"error\"") != std::string::npos) {
+      ++result.error_count;
+      continue;
+    }
+    int64_t fee = 0;
+    FindJsonNumber(response, "feeAmount", 0, &fee);
+    result.total_fee += fee;
+    if ((api == "fund") || (api == "psbt")) {
+      if (response.find("\"usedAddresses\":[]") != std::string::npos) {
+        ++result.changeless_count;
+      }
+      continue;
+    }
+
+    int64_t selected = 0;
+    int64_t utxo_fee = 0;
+    if (is_elements) {
+      size_t pos = response.find("\"selectedAmounts\":");
+      if (pos != std::string::npos) {
+        FindJsonNumber(response, "amount", pos, &selected);
+      }
+    } else {
+      FindJsonNumber(response, "selectedAmount", 0, &selected);
+    }
+    FindJsonNumber(response, "utxoFeeAmount", 0, &utxo_fee);
+    int64_t excess = selected - target - fee;
+    bool is_changeless = (excess < change_cost);
+    if (is_changeless) ++result.changeless_count;
+    // waste: (fee - long-term fee) of the inputs + excess or change cost
+    int64_t input_waste = static_cast<int64_t>(
+        utxo_fee * (kFeeRate - kLongTermFeeRate) / kFeeRate);
+    result.total_waste +=
+        input_waste + (is_changeless ? excess : change_cost);
+    result.has_waste = true;
+  }
+  return result;
+}
+
+/**
+ * @brief Get the percentile.
+ * @param[in] sorted_values   sorted values
+ * @param[in] percent         percentile
+ * @return value
+ */
+static double GetPercentile(
+    const std::vector<double>& sorted_values, double percent) {
+  if (sorted_values.empty()) return 0;
+  size_t index = static_cast<size_t>(
+      std::ceil(percent / 100.0 * sorted_values.size()));
+  if (index > 0) --index;
+  return sorted_values[std::min(index, sorted_values.size() - 1)];
+}
+
+/**
+ * @brief Parse the command line.
+ * @param[in] argc    argument count
+ * @param[in] argv    arguments
+ * @param[out] option benchmark option
+ * @retval true   success
+ * @retval false  invalid argument
+ */
+static bool ParseOption(int argc, char* argv[], BenchOption* option) {
+  for (int index = 1; index < argc; ++index) {
+    std::string arg = argv[index];
+    size_t pos = arg.find('=');
+    std::string key = arg.substr(0, pos);
+    std::string value = (pos == std::string::npos) ? "" : arg.substr(pos + 1);
+    if (key == "--sizes") {
+      option->sizes.clear();
+      for (const auto& size : SplitList(value)) {
+        option->sizes.push_back(std::strtoull(size.c_str(), nullptr, 10));
+      }
+    } else if (key == "--iterations") {
+      option->iterations =
+          static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+    } else if (key == "--seed") {
+      option->seed = std::strtoull(value.c_str(), nullptr, 10);
+    } else if (key == "--api") {
+      option->apis = SplitList(value);
+    } else if (key == "--network") {
+      option->networks = SplitList(value);
+    } else if (
+        (key == "--source") && ((value == "request") || (value == "pool"))) {
+      option->source = value;
+    } else {
+      std::fprintf(stderr, "unknown option: %s\n", arg.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  BenchOption option;
+  if (!ParseOption(argc, argv, &option)) return 1;
+  const bool is_pool = (option.source == "pool");
+
+  static const struct {
+    Distribution distribution;
+    const char* name;
+  } kDistributions[] = {
+      {Distribution::kUniform, "uniform"},
+      {Distribution::kPowerLaw, "powerlaw"},
+      {Distribution::kDustHeavy, "dust"},
+  };
+
+  std::printf(
+      "%-9s %-8s %-8s %8s %9s %9s %9s %10s %9s %10s %6s\n", "network",
+      "api", "dist", "utxos", "p50(ms)", "p90(ms)", "p99(ms)", "changeless",
+      "avg_fee", "avg_waste", "errors");
+  for (const auto& network : option.networks) {
+    bool is_elements = (network == "elements");
+    for (size_t size : option.sizes) {
+      for (const auto& dist : kDistributions) {
+        std::mt19937_64 random(option.seed);
+        std::vector<int64_t> amounts =
+            GenerateAmounts(size, dist.distribution, &random);
+        std::vector<std::string> utxo_list =
+            CreateUtxoJsonList(amounts, is_elements);
+        int64_t total = 0;
+        for (int64_t amount : amounts) total += amount;
+
+        // targets up to a tenth of the wallet balance
+        std::uniform_int_distribution<int64_t> target_range(
+            100000, std::max<int64_t>(total / 10, 100001));
+        std::vector<int64_t> targets(option.iterations);
+        for (auto& target : targets) target = target_range(random);
+
+        // every api of this wallet takes the utxos from the same source.
+        int64_t pool_id = 0;
+        std::string utxo_field;
+        if (is_pool) {
+          pool_id = CreatePool(utxo_list, is_elements);
+          if (pool_id == 0) {
+            std::fprintf(stderr, "failed to create the utxo pool.\n");
+            return 1;
+          }
+          utxo_field = "\"utxoPoolId\":" + std::to_string(pool_id);
+        } else {
+          utxo_field =
+              "\"utxos\":" + JoinJsonList(utxo_list, 0, utxo_list.size());
+        }
+        for (const auto& api : option.apis) {
+          if ((api == "psbt") && is_elements) continue;  // bitcoin only
+          if ((api == "psbt") && is_pool) continue;      // no pool support
+          BenchResult result = RunCase(api, is_elements, utxo_field, targets);
+          std::sort(result.latencies.begin(), result.latencies.end());
+          uint32_t success = option.iterations - result.error_count;
+          double divisor = (success == 0) ? 1 : success;
+          std::string waste =
+              result.has_waste
+                  ? std::to_string(static_cast<int64_t>(
+                        result.total_waste / divisor))
+                  : "-";
+          std::printf(
+              "%-9s %-8s %-8s %8zu %9.3f %9.3f %9.3f %9.1f%% %9" PRId64
+              " %10s %6u\n",
+              network.c_str(), api.c_str(), dist.name, size,
+              GetPercentile(result.latencies, 50),
+              GetPercentile(result.latencies, 90),
+              GetPercentile(result.latencies, 99),
+              result.changeless_count * 100.0 / divisor,
+              static_cast<int64_t>(result.total_fee / divisor), waste.c_str(),
+              result.error_count);
+          std::fflush(stdout);
+        }
+        if (is_pool) {
+          JsonMappingApi::DeleteUtxoPool(
+              "{\"poolId\":" + std::to_string(pool_id) + "}");
+        }
+      }
+    }
+  }
+  return 0;
+}
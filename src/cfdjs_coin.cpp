@@ -7,31 +7,468 @@
 #include "cfdjs_coin.h"  // NOLINT
 
 #include <algorithm>
+#include <cmath>
+#include <exception>
 #include <map>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <set>
 #include <string>
 #include <vector>
 
 #include "cfd/cfd_utxo.h"
-#include "cfdjs_internal.h"  // NOLINT
+#include "cfdcore/cfdcore_bytedata.h"
+#include "cfdjs/cfdjs_api_coin.h"
+#include "cfdjs_coin_selection.h"  // NOLINT
+#include "cfdjs_internal.h"        // NOLINT
+#include "cfdjs_size_estimator.h"  // NOLINT
+#include "cfdjs_utxo_pool.h"       // NOLINT
 
 namespace cfd {
 namespace js {
 namespace api {
+
+UtxoPoolInfoResponseStruct CoinStructApi::CreateUtxoPool(
+    const CreateUtxoPoolRequestStruct& request) {
+  auto call_func = [](const CreateUtxoPoolRequestStruct& request)
+      -> UtxoPoolInfoResponseStruct {  // NOLINT
+    UtxoPoolInfoResponseStruct result;
+    auto pool = UtxoPoolManager::GetInstance().CreatePool(request.is_elements);
+    auto lock = pool->GetLock();
+    pool->GetInfo(&result);
+    return result;
+  };
+
+  UtxoPoolInfoResponseStruct result;
+  result = ExecuteStructApi<
+      CreateUtxoPoolRequestStruct, UtxoPoolInfoResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
+UtxoPoolInfoResponseStruct CoinStructApi::AddUtxoPoolItems(
+    const AddUtxoPoolItemsRequestStruct& request) {
+  auto call_func = [](const AddUtxoPoolItemsRequestStruct& request)
+      -> UtxoPoolInfoResponseStruct {  // NOLINT
+    UtxoPoolInfoResponseStruct result;
+    auto pool = UtxoPoolManager::GetInstance().GetPool(request.pool_id);
+    auto lock = pool->GetLock();
+    pool->AddUtxos(request.utxos);
+    pool->GetInfo(&result);
+    return result;
+  };
+
+  UtxoPoolInfoResponseStruct result;
+  result = ExecuteStructApi<
+      AddUtxoPoolItemsRequestStruct, UtxoPoolInfoResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
+UtxoPoolInfoResponseStruct CoinStructApi::RemoveUtxoPoolItems(
+    const RemoveUtxoPoolItemsRequestStruct& request) {
+  auto call_func = [](const RemoveUtxoPoolItemsRequestStruct& request)
+      -> UtxoPoolInfoResponseStruct {  // NOLINT
+    UtxoPoolInfoResponseStruct result;
+    auto pool = UtxoPoolManager::GetInstance().GetPool(request.pool_id);
+    auto lock = pool->GetLock();
+    pool->RemoveUtxos(request.outpoints);
+    pool->GetInfo(&result);
+    return result;
+  };
+
+  UtxoPoolInfoResponseStruct result;
+  result = ExecuteStructApi<
+      RemoveUtxoPoolItemsRequestStruct, UtxoPoolInfoResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
+UtxoPoolInfoResponseStruct CoinStructApi::LockUtxoPoolItems(
+    const LockUtxoPoolItemsRequestStruct& request) {
+  auto call_func = [](const LockUtxoPoolItemsRequestStruct& request)
+      -> UtxoPoolInfoResponseStruct {  // NOLINT
+    UtxoPoolInfoResponseStruct result;
+    auto pool = UtxoPoolManager::GetInstance().GetPool(request.pool_id);
+    auto lock = pool->GetLock();
+    pool->LockUtxos(request.outpoints, request.is_lock);
+    pool->GetInfo(&result);
+    return result;
+  };
+
+  UtxoPoolInfoResponseStruct result;
+  result = ExecuteStructApi<
+      LockUtxoPoolItemsRequestStruct, UtxoPoolInfoResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
+UtxoPoolInfoResponseStruct CoinStructApi::DeleteUtxoPool(
+    const DeleteUtxoPoolRequestStruct& request) {
+  auto call_func = [](const DeleteUtxoPoolRequestStruct& request)
+      -> UtxoPoolInfoResponseStruct {  // NOLINT
+    UtxoPoolInfoResponseStruct result;
+    auto pool = UtxoPoolManager::GetInstance().DeletePool(request.pool_id);
+    auto lock = pool->GetLock();
+    pool->GetInfo(&result);
+    return result;
+  };
+
+  UtxoPoolInfoResponseStruct result;
+  result = ExecuteStructApi<
+      DeleteUtxoPoolRequestStruct, UtxoPoolInfoResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 namespace json {
 
 using cfd::AmountMap;
 using cfd::Utxo;
+using cfd::core::ByteData;
 using cfd::core::CfdError;
 using cfd::core::CfdException;
 
+//! default txin type for the fee estimation.
+static constexpr const char* kDefaultTxInType = "p2wpkh";
+//! payout count limit of SelectUtxosBatch to select in every order
+static constexpr size_t kSelectUtxosBatchJointLimit = 5;
+//! selection state format version
+static constexpr uint8_t kSelectionStateVersion = 1;
+//! selection state flag: the fee asset was selected without a change
+static constexpr uint8_t kSelectionStateChangeless = 0x01;
+//! selection state header size (version, flags, utxo count)
+static constexpr size_t kSelectionStateHeaderSize = 6;
+//! selection state utxo size (txid, vout, txin vsize)
+static constexpr size_t kSelectionStateUtxoSize = 40;
+
+/**
+ * @brief Get the txin virtual size.
+ * @param[in] size          txin size
+ * @param[in] is_elements   elements transaction flag
+ * @return txin virtual size
+ */
+static int64_t GetTxInVsize(const TxSizeData& size, bool is_elements) {
+  int64_t weight = (static_cast<int64_t>(size.no_witness_size) * 4) +
+                   size.witness_size;
+  if (is_elements) weight += 3;
+  return (weight + 3) / 4;
+}
+
+/**
+ * @brief Get the cost of change (creating and spending a p2wpkh change).
+ * @param[in] fee_info      fee information
+ * @param[in] is_elements   elements transaction flag
+ * @return cost of change
+ */
+static int64_t GetCostOfChange(
+    const CoinSelectionFeeInformationField& fee_info, bool is_elements) {
+  EstimateTransactionSizeCandidateStruct candidate;
+  int64_t base_weight = TxSizeEstimator::EstimateWeight(
+      candidate, is_elements, fee_info.GetExponent(),
+      fee_info.GetMinimumBits());
+  EstimateSizeOutputDataStruct output;
+  output.type = "p2wpkh";
+  output.is_blind = is_elements;
+  candidate.outputs.push_back(output);
+  int64_t output_weight =
+      TxSizeEstimator::EstimateWeight(
+          candidate, is_elements, fee_info.GetExponent(),
+          fee_info.GetMinimumBits()) -
+      base_weight;
+
+  EstimateSizeInputDataStruct input;
+  input.type = kDefaultTxInType;
+  int64_t output_vsize = (output_weight + 3) / 4;
+  int64_t input_vsize =
+      GetTxInVsize(TxSizeEstimator::GetTxInSize(input), is_elements);
+  return static_cast<int64_t>(
+      std::ceil(output_vsize * fee_info.GetFeeRate()) +
+      std::ceil(input_vsize * fee_info.GetLongTermFeeRate()));
+}
+
+/**
+ * @brief Get the txin virtual size list of the utxos.
+ * @details The size is estimated from the descriptor, then the scriptSig
+ *     template, then the default txin type (p2wpkh, same as the change).
+ * @param[in] utxos         utxo list
+ * @param[in] is_elements   elements transaction flag
+ * @return txin virtual size list
+ */
+static std::vector<int64_t> GetTxInVsizeList(
+    const std::vector<Utxo>& utxos, bool is_elements) {
+  std::vector<int64_t> vsizes(utxos.size(), 0);
+  for (size_t index = 0; index < utxos.size(); ++index) {
+    const UtxoJsonData* json_data =
+        static_cast<const UtxoJsonData*>(utxos[index].binary_data);
+    std::string descriptor;
+    uint32_t template_size = 0;
+    if (json_data != nullptr) {
+      descriptor = json_data->GetDescriptor();
+      template_size =
+          static_cast<uint32_t>(json_data->GetScriptSigTemplate().size() / 2);
+    }
+    vsizes[index] = GetTxInVsize(
+        TxSizeEstimator::GetUtxoTxInSize(
+            descriptor, template_size, kDefaultTxInType),
+        is_elements);
+  }
+  return vsizes;
+}
+
+/**
+ * @brief Build the utxo columns of the asset.
+ * @param[in] utxos     utxo list
+ * @param[in] vsizes    txin virtual size list (same order as utxos)
+ * @param[in] is_used   used flag list (same order as utxos)
+ * @param[in] asset     asset (empty is all utxos)
+ * @param[out] columns  utxo columns
+ */
+static void CreateUtxoColumns(
+    const std::vector<Utxo>& utxos, const std::vector<int64_t>& vsizes,
+    const std::vector<bool>& is_used, const std::string& asset,
+    UtxoColumns* columns) {
+  columns->Clear();
+  columns->Reserve(utxos.size());
+  for (size_t index = 0; index < utxos.size(); ++index) {
+    const UtxoJsonData* json_data =
+        static_cast<const UtxoJsonData*>(utxos[index].binary_data);
+    if ((json_data == nullptr) || is_used[index]) continue;
+    if (!asset.empty() && (json_data->GetAsset() != asset)) continue;
+    columns->Add(
+        static_cast<uint32_t>(index), json_data->GetAmount(),
+        static_cast<uint32_t>(vsizes[index]));
+  }
+}
+
+/**
+ * @brief Get the outpoint key of the selection state.
+ * @param[in] txid  txid
+ * @param[in] vout  vout
+ * @return outpoint key
+ */
+static std::string GetSelectionStateKey(const ByteData& txid, uint32_t vout) {
+  return txid.GetHex() + ":" + std::to_string(vout);
+}
+
+/**
+ * @brief Serialize the selection state.
+ * @details The state is the seed of ReselectUtxos: the selected outpoints
+ *     with their txin vsizes, and whether the fee asset was selected without
+ *     a change by BnB. It is opaque for the caller.
+ * @param[in] utxos           selected utxo list
+ * @param[in] vsizes          txin virtual size list (same order as utxos)
+ * @param[in] is_changeless   fee asset selected without a change flag
+ * @return selection state (hex)
+ */
+static std::string SerializeSelectionState(
+    const std::vector<const UtxoJsonData*>& utxos,
+    const std::vector<int64_t>& vsizes, bool is_changeless) {
+  std::vector<uint8_t> state;
+  state.reserve(
+      kSelectionStateHeaderSize + (utxos.size() * kSelectionStateUtxoSize));
+  auto add_uint32 = [&state](uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+      state.push_back(static_cast<uint8_t>(value >> shift));
+    }
+  };
+  state.push_back(kSelectionStateVersion);
+  state.push_back((is_changeless) ? kSelectionStateChangeless : 0);
+  add_uint32(static_cast<uint32_t>(utxos.size()));
+  for (size_t index = 0; index < utxos.size(); ++index) {
+    // the txid is checked by the utxo conversion, so it has 32 bytes.
+    std::vector<uint8_t> txid = ByteData(utxos[index]->GetTxid()).GetBytes();
+    state.insert(state.end(), txid.begin(), txid.end());
+    add_uint32(utxos[index]->GetVout());
+    add_uint32(static_cast<uint32_t>(vsizes[index]));
+  }
+  return ByteData(state).GetHex();
+}
+
+/**
+ * @brief Parse the selection state.
+ * @param[in] selection_state   selection state (hex)
+ * @param[out] is_changeless    fee asset selected without a change flag
+ * @return txin virtual size map (key: outpoint key)
+ */
+static std::map<std::string, int64_t> ParseSelectionState(
+    const std::string& selection_state, bool* is_changeless) {
+  std::vector<uint8_t> state = ByteData(selection_state).GetBytes();
+  auto read_uint32 = [&state](size_t offset) -> uint32_t {
+    uint32_t value = 0;
+    for (int index = 3; index >= 0; --index) {
+      value = (value << 8) | state[offset + index];
+    }
+    return value;
+  };
+  if ((state.size() < kSelectionStateHeaderSize) ||
+      (state[0] != kSelectionStateVersion) ||
+      (state.size() != kSelectionStateHeaderSize +
+                           (static_cast<size_t>(read_uint32(2)) *
+                            kSelectionStateUtxoSize))) {
+    warn(
+        CFD_LOG_SOURCE,
+        "Failed to ReselectUtxos. selectionState is invalid.: size={}",
+        state.size());
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to ReselectUtxos. selectionState is invalid.");
+  }
+  *is_changeless = (state[1] & kSelectionStateChangeless) != 0;
+  std::map<std::string, int64_t> vsizes;
+  for (size_t offset = kSelectionStateHeaderSize; offset < state.size();
+       offset += kSelectionStateUtxoSize) {
+    ByteData txid(std::vector<uint8_t>(
+        state.begin() + offset, state.begin() + offset + 32));
+    vsizes.emplace(
+        GetSelectionStateKey(txid, read_uint32(offset + 32)),
+        read_uint32(offset + 36));
+  }
+  return vsizes;
+}
+
+/**
+ * @brief Select coins by the columnar coin selection engine.
+ * @param[in] utxos             utxo list
+ * @param[in] vsizes            txin virtual size list (same order as utxos)
+ * @param[in] is_used           used flag list (used utxos are not selected)
+ * @param[in] map_target_amount target amount map (bitcoin: empty asset key)
+ * @param[in] fee_info          fee information
+ * @param[in] bnb_option        BnB search option
+ * @param[in] is_elements       elements transaction flag
+ * @param[in] is_parallel_asset select the non-fee assets concurrently
+ * @param[out] map_select_amount  selected amount map
+ * @param[out] utxo_fee         fee of the selected txins
+ * @param[out] bnb_statistics   BnB search statistics (nullable)
+ * @param[out] is_bnb_searched  BnB search executed flag
+ * @return selected utxo index list
+ */
+static std::vector<uint32_t> SelectCoinsByColumns(
+    const std::vector<Utxo>& utxos, const std::vector<int64_t>& vsizes,
+    const std::vector<bool>& is_used, const AmountMap& map_target_amount,
+    const CoinSelectionFeeInformationField& fee_info,
+    const BnbSearchOption& bnb_option, bool is_elements,
+    bool is_parallel_asset, AmountMap* map_select_amount, int64_t* utxo_fee,
+    BnbSearchStatistics* bnb_statistics, bool* is_bnb_searched) {
+  double fee_rate = fee_info.GetFeeRate();
+  double long_term_fee_rate =
+      (fee_rate == 0) ? 0 : fee_info.GetLongTermFeeRate();
+  std::string fee_asset = (is_elements) ? fee_info.GetFeeAsset() : "";
+
+  CoinSelectionParameter param;
+  param.min_change = fee_info.GetKnapsackMinChange();
+  if (param.min_change < 0) {
+    param.min_change = CoinSelectionEngine::kDefaultMinChange;
+  }
+  if (fee_rate == 0) param.min_change = 0;
+  param.bnb_max_tries = bnb_option.GetMaxTries();
+  param.bnb_time_budget = bnb_option.GetTimeBudget();
+  param.bnb_thread_count = bnb_option.GetThreadCount();
+
+  std::vector<uint32_t> result;
+  UtxoColumns columns;
+  CoinSelectionResult selection;
+  int64_t fee_asset_target = 0;
+  int64_t input_fee = 0;
+  *utxo_fee = 0;
+  *is_bnb_searched = false;
+  // The other assets are independent, so they can be selected at once.
+  // The fee asset is selected last, because the txin fees of the other
+  // assets are added to its target.
+  std::vector<std::string> assets;
+  std::vector<UtxoColumns> columns_list;
+  std::vector<CoinSelectionParameter> params;
+  for (const auto& target : map_target_amount) {
+    if (target.first == fee_asset) {
+      fee_asset_target = target.second;
+      continue;
+    }
+    if (target.second <= 0) continue;
+    assets.push_back(target.first);
+    columns_list.emplace_back();
+    CreateUtxoColumns(
+        utxos, vsizes, is_used, target.first, &columns_list.back());
+    columns_list.back().UpdateEffectiveValues(
+        fee_rate, long_term_fee_rate, false);
+    params.push_back(param);
+    params.back().target_value = target.second;
+    params.back().use_bnb = false;
+  }
+  std::vector<CoinSelectionResult> selections;
+  std::vector<bool> is_selected = CoinSelectionEngine::SelectCoinsParallel(
+      columns_list, params, (is_parallel_asset) ? 0 : 1, &selections);
+  for (size_t index = 0; index < assets.size(); ++index) {
+    if (!is_selected[index]) {
+      warn(
+          CFD_LOG_SOURCE,
+          "Failed to select coin. Not enough utxos.: asset={}", assets[index]);
+      throw CfdException(
+          CfdError::kCfdIllegalStateError,
+          "Failed to select coin. Not enough utxos.");
+    }
+    const auto& indexes = selections[index].indexes;
+    result.insert(result.end(), indexes.begin(), indexes.end());
+    (*map_select_amount)[assets[index]] = selections[index].selected_amount;
+    input_fee += selections[index].utxo_fee;
+  }
+
+  param.target_value = (fee_asset_target > 0) ? fee_asset_target : 0;
+  param.fixed_fee = 0;
+  if ((fee_rate != 0) || (param.target_value > 0)) {
+    param.fixed_fee = fee_info.GetTxFeeAmount() + input_fee;
+  }
+  if (param.target_value + param.fixed_fee <= 0) return result;
+  param.cost_of_change = GetCostOfChange(fee_info, is_elements);
+  param.use_bnb = (fee_rate != 0);
+  CreateUtxoColumns(utxos, vsizes, is_used, fee_asset, &columns);
+  columns.UpdateEffectiveValues(fee_rate, long_term_fee_rate);
+  if (!CoinSelectionEngine::SelectCoins(columns, param, &selection)) {
+    warn(
+        CFD_LOG_SOURCE, "Failed to select coin. Not enough utxos.: asset={}",
+        fee_asset);
+    throw CfdException(
+        CfdError::kCfdIllegalStateError,
+        "Failed to select coin. Not enough utxos.");
+  }
+  result.insert(
+      result.end(), selection.indexes.begin(), selection.indexes.end());
+  (*map_select_amount)[fee_asset] = selection.selected_amount;
+  *utxo_fee = input_fee + selection.utxo_fee;
+
+  if (param.use_bnb && (bnb_statistics != nullptr)) {
+    const BnbStatistics& statistics = selection.bnb_statistics;
+    bnb_statistics->SetIsSelected(selection.use_bnb);
+    bnb_statistics->SetTries(static_cast<int64_t>(statistics.tries));
+    bnb_statistics->SetElapsedTime(
+        static_cast<int64_t>(statistics.elapsed_time));
+    bnb_statistics->SetThreadCount(statistics.thread_count);
+    bnb_statistics->SetSubtreeCount(statistics.subtree_count);
+    bnb_statistics->SetIsTimeout(statistics.is_timeout);
+    bnb_statistics->SetIsCompleted(statistics.is_completed);
+    *is_bnb_searched = true;
+  }
+  return result;
+}
+
 void CoinJsonApi::SelectUtxos(
     SelectUtxosWrapRequest* req, SelectUtxosWrapResponse* res) {
-  const std::vector<Utxo>& utxos = req->GetUtxoList();
   CoinSelectionFeeInformationField fee_info = req->GetFeeInfo();
   Amount target_amount;
   AmountMap map_target_amount;
   bool is_elements = req->GetIsElements();
 
+  // The pool stays locked until the response refers to its utxo data.
+  std::shared_ptr<UtxoPool> pool;
+  std::unique_lock<std::mutex> pool_lock;
+  const std::vector<Utxo>* utxo_list = &req->GetUtxoList();
+  if (req->GetUtxoPoolId() != 0) {
+    pool = UtxoPoolManager::GetInstance().GetPool(
+        req->GetUtxoPoolId(), is_elements, !req->GetUtxos().empty());
+    pool_lock = pool->GetLock();
+    utxo_list = &pool->GetUtxoList();
+  }
+  const std::vector<Utxo>& utxos = *utxo_list;
+
   // in parameter
   CoinSelectionOption option;
   UtxoFilter filter;
@@ -92,7 +529,48 @@ void CoinJsonApi::SelectUtxos(
 
   CoinSelection coin_selection;
   std::vector<Utxo> ret_utxos;
-  if (!is_elements) {
+  if (req->GetSelectionMode() == "columnar") {
+    AmountMap map_columnar_target = map_target_amount;
+    if (!is_elements) {
+      map_columnar_target.emplace("", target_amount.GetSatoshiValue());
+    }
+    int64_t columnar_utxo_fee = 0;
+    bool is_bnb_searched = false;
+    const std::vector<int64_t> vsizes = GetTxInVsizeList(utxos, is_elements);
+    std::vector<uint32_t> indexes = SelectCoinsByColumns(
+        utxos, vsizes, std::vector<bool>(utxos.size(), false),
+        map_columnar_target, fee_info, req->GetBnbOption(), is_elements,
+        req->GetParallelAssetSelection(), &map_select_amount,
+        &columnar_utxo_fee, &res->GetBnbStatistics(), &is_bnb_searched);
+    std::vector<const UtxoJsonData*> state_utxos;
+    std::vector<int64_t> state_vsizes;
+    for (uint32_t index : indexes) {
+      ret_utxos.push_back(utxos[index]);
+      state_utxos.push_back(
+          static_cast<const UtxoJsonData*>(utxos[index].binary_data));
+      state_vsizes.push_back(vsizes[index]);
+    }
+    res->SetSelectionState(SerializeSelectionState(
+        state_utxos, state_vsizes,
+        is_bnb_searched && res->GetBnbStatistics().GetIsSelected()));
+    utxo_fee = Amount::CreateBySatoshiAmount(columnar_utxo_fee);
+    if (!is_bnb_searched) res->SetIgnoreItem("bnbStatistics");
+    if (!is_elements) {
+      select_amount = Amount::CreateBySatoshiAmount(map_select_amount[""]);
+      res->SetSelectedAmount(select_amount.GetSatoshiValue());
+      res->SetIgnoreItem("selectedAmounts");
+    } else {
+      for (const auto& target : map_target_amount) {
+        if (target.second > 0) target_amount += target.second;
+      }
+      if ((fee_info.GetFeeRate() != 0) || (target_amount != 0)) {
+        res->SetSelectedAmountMap(map_select_amount);
+      }
+      res->SetIgnoreItem("selectedAmount");
+    }
+  } else if (!is_elements) {
+    res->SetIgnoreItem("bnbStatistics");
+    res->SetIgnoreItem("selectionState");
     option.InitializeTxSizeInfo();
     ret_utxos = coin_selection.SelectCoins(
         target_amount, utxos, filter, option, tx_fee, &select_amount,
@@ -101,6 +579,8 @@ void CoinJsonApi::SelectUtxos(
     res->SetIgnoreItem("selectedAmounts");
   } else {
 #ifndef CFD_DISABLE_ELEMENTS
+    res->SetIgnoreItem("bnbStatistics");
+    res->SetIgnoreItem("selectionState");
     option.InitializeConfidentialTxSizeInfo();
     ret_utxos = coin_selection.SelectCoins(
         map_target_amount, utxos, filter, option, tx_fee, &map_select_amount,
@@ -131,6 +611,472 @@ void CoinJsonApi::SelectUtxos(
   }
 }
 
+void CoinJsonApi::SelectUtxosBatch(
+    SelectUtxosBatchRequest* req, SelectUtxosBatchResponse* res) {
+  CoinSelectionFeeInformationField fee_info = req->GetFeeInfo();
+  bool is_elements = req->GetIsElements();
+#ifdef CFD_DISABLE_ELEMENTS
+  if (is_elements) {
+    warn(CFD_LOG_SOURCE, "Not Support Elements.");
+    throw CfdException(
+        CfdError::kCfdIllegalStateError, "Not Support Elements.");
+  }
+#endif  // CFD_DISABLE_ELEMENTS
+  if (is_elements && fee_info.GetFeeAsset().empty() &&
+      (fee_info.GetFeeRate() != 0)) {
+    warn(CFD_LOG_SOURCE, "Failed to SelectUtxosBatch. feeAsset is required.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to SelectUtxosBatch. feeAsset is required.");
+  }
+
+  // The pool stays locked until the response copies its utxo data.
+  std::shared_ptr<UtxoPool> pool;
+  std::unique_lock<std::mutex> pool_lock;
+  std::vector<Utxo> request_utxos;
+  const std::vector<Utxo>* utxo_list = &request_utxos;
+  if (req->GetUtxoPoolId() != 0) {
+    pool = UtxoPoolManager::GetInstance().GetPool(
+        req->GetUtxoPoolId(), is_elements, !req->GetUtxos().empty());
+    pool_lock = pool->GetLock();
+    utxo_list = &pool->GetUtxoList();
+  } else {
+    auto& json_utxos = req->GetUtxos();
+    request_utxos.resize(json_utxos.size());
+    auto utxo_ite = request_utxos.begin();
+    for (const auto& json_utxo : json_utxos) {
+      SelectUtxosWrapRequest::ConvertToUtxo(json_utxo, &(*utxo_ite));
+      ++utxo_ite;
+    }
+  }
+  const std::vector<Utxo>& utxos = *utxo_list;
+
+  auto& payouts = req->GetPayouts();
+  const std::string fee_asset = (is_elements) ? fee_info.GetFeeAsset() : "";
+  std::vector<AmountMap> target_list(payouts.size());
+  std::vector<int64_t> total_target_list(payouts.size(), 0);
+  std::vector<int64_t> fee_target_list(payouts.size(), 0);
+  std::vector<size_t> order(payouts.size());
+  for (size_t index = 0; index < payouts.size(); ++index) {
+    auto& payout = payouts[index];
+    AmountMap& targets = target_list[index];
+    if (!is_elements) {
+      targets.emplace("", payout.GetTargetAmount());
+    } else if (payout.GetTargets().empty()) {
+      warn(
+          CFD_LOG_SOURCE,
+          "Failed to SelectUtxosBatch. targets is required.: index={}", index);
+      throw CfdException(
+          CfdError::kCfdIllegalArgumentError,
+          "Failed to SelectUtxosBatch. targets is required.");
+    } else {
+      for (const auto& target : payout.GetTargets()) {
+        targets.emplace(target.GetAsset(), target.GetAmount());
+      }
+    }
+    for (const auto& target : targets) {
+      if (target.second > 0) total_target_list[index] += target.second;
+    }
+    auto fee_ite = targets.find(fee_asset);
+    if ((fee_ite != targets.end()) && (fee_ite->second > 0)) {
+      fee_target_list[index] = fee_ite->second;
+    }
+    order[index] = index;
+  }
+  // The amounts of different assets are not comparable, so the payouts are
+  // ordered by the fee asset target. Larger payouts are funded first, so the
+  // small ones can take the rest.
+  std::stable_sort(
+      order.begin(), order.end(),
+      [&fee_target_list](size_t lhs, size_t rhs) -> bool {
+        return fee_target_list[lhs] > fee_target_list[rhs];
+      });
+
+  const std::vector<int64_t> vsizes = GetTxInVsizeList(utxos, is_elements);
+  std::vector<std::vector<uint32_t>> index_list;
+  std::vector<AmountMap> select_amount_list;
+  std::vector<int64_t> utxo_fee_list;
+  auto select_by_order =
+      [&](const std::vector<size_t>& select_order,
+          std::vector<std::vector<uint32_t>>* indexes,
+          std::vector<AmountMap>* select_amounts,
+          std::vector<int64_t>* utxo_fees) -> int64_t {
+    std::vector<bool> is_used(utxos.size(), false);
+    indexes->assign(payouts.size(), std::vector<uint32_t>());
+    select_amounts->assign(payouts.size(), AmountMap());
+    utxo_fees->assign(payouts.size(), 0);
+    int64_t total_utxo_fee = 0;
+    for (size_t index : select_order) {
+      bool is_bnb_searched = false;
+      (*indexes)[index] = SelectCoinsByColumns(
+          utxos, vsizes, is_used, target_list[index], fee_info,
+          req->GetBnbOption(), is_elements, false, &(*select_amounts)[index],
+          &(*utxo_fees)[index], nullptr, &is_bnb_searched);
+      for (uint32_t utxo_index : (*indexes)[index]) is_used[utxo_index] = true;
+      total_utxo_fee += (*utxo_fees)[index];
+    }
+    return total_utxo_fee;
+  };
+
+  // Small batches are selected in every order too, and the order of the
+  // lowest total fee is used. The sorted order is tried first, so it wins
+  // a tie, and its error is reported when no order can fund all payouts.
+  std::vector<std::vector<size_t>> order_list(1, order);
+  if (payouts.size() <= kSelectUtxosBatchJointLimit) {
+    std::vector<size_t> permutation(order);
+    std::sort(permutation.begin(), permutation.end());
+    do {
+      if (permutation != order) order_list.push_back(permutation);
+    } while (std::next_permutation(permutation.begin(), permutation.end()));
+  }
+  bool is_selected = false;
+  int64_t best_utxo_fee = 0;
+  std::exception_ptr first_error;
+  std::vector<std::vector<uint32_t>> indexes;
+  std::vector<AmountMap> select_amounts;
+  std::vector<int64_t> utxo_fees;
+  for (const auto& select_order : order_list) {
+    try {
+      int64_t total_utxo_fee = select_by_order(
+          select_order, &indexes, &select_amounts, &utxo_fees);
+      if (!is_selected || (total_utxo_fee < best_utxo_fee)) {
+        is_selected = true;
+        best_utxo_fee = total_utxo_fee;
+        index_list.swap(indexes);
+        select_amount_list.swap(select_amounts);
+        utxo_fee_list.swap(utxo_fees);
+      }
+    } catch (const CfdException&) {
+      if (!first_error) first_error = std::current_exception();
+    }
+  }
+  if (!is_selected) std::rethrow_exception(first_error);
+
+  int64_t total_fee = 0;
+  auto& results = res->GetResults();
+  std::vector<OutPointStruct> outpoints;
+  for (size_t index = 0; index < payouts.size(); ++index) {
+    SelectUtxosBatchResult result;
+    for (uint32_t utxo_index : index_list[index]) {
+      const UtxoJsonData* json_data =
+          static_cast<const UtxoJsonData*>(utxos[utxo_index].binary_data);
+      result.GetUtxos().push_back(*json_data);
+      OutPointStruct outpoint;
+      outpoint.txid = json_data->GetTxid();
+      outpoint.vout = json_data->GetVout();
+      outpoints.push_back(outpoint);
+    }
+    const AmountMap& select_amounts = select_amount_list[index];
+    if (!is_elements) {
+      auto ite = select_amounts.find("");
+      if (ite != select_amounts.end()) result.SetSelectedAmount(ite->second);
+      result.SetIgnoreItem("selectedAmounts");
+    } else {
+      if ((fee_info.GetFeeRate() != 0) || (total_target_list[index] != 0)) {
+        for (const auto& select_amount : select_amounts) {
+          TargetAmountMapData amount_data;
+          amount_data.SetAsset(select_amount.first);
+          amount_data.SetAmount(select_amount.second);
+          result.GetSelectedAmounts().push_back(amount_data);
+        }
+      }
+      result.SetIgnoreItem("selectedAmount");
+    }
+
+    int64_t utxo_fee = utxo_fee_list[index];
+    if (utxo_fee == 0) result.SetIgnoreItem("utxoFeeAmount");
+    result.SetUtxoFeeAmount(utxo_fee);
+    int64_t fee = fee_info.GetTxFeeAmount() + utxo_fee;
+    if ((fee_info.GetFeeRate() != 0) || (total_target_list[index] != 0)) {
+      result.SetFeeAmount(fee);
+      total_fee += fee;
+    }
+    if (fee == 0) result.SetIgnoreItem("feeAmount");
+    results.push_back(result);
+  }
+  res->SetTotalFeeAmount(total_fee);
+
+  if ((pool != nullptr) && req->GetLockSelectedUtxos()) {
+    pool->LockUtxos(outpoints, true);
+  }
+}
+
+void CoinJsonApi::ReselectUtxos(
+    ReselectUtxosRequest* req, ReselectUtxosResponse* res) {
+  CoinSelectionFeeInformationField fee_info = req->GetFeeInfo();
+  bool is_elements = req->GetIsElements();
+#ifdef CFD_DISABLE_ELEMENTS
+  if (is_elements) {
+    warn(CFD_LOG_SOURCE, "Not Support Elements.");
+    throw CfdException(
+        CfdError::kCfdIllegalStateError, "Not Support Elements.");
+  }
+#endif  // CFD_DISABLE_ELEMENTS
+  if (is_elements && fee_info.GetFeeAsset().empty() &&
+      (fee_info.GetFeeRate() != 0)) {
+    warn(CFD_LOG_SOURCE, "Failed to ReselectUtxos. feeAsset is required.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to ReselectUtxos. feeAsset is required.");
+  }
+  auto& previous_json_utxos = req->GetPreviousUtxos();
+  if (previous_json_utxos.empty()) {
+    warn(CFD_LOG_SOURCE, "Failed to ReselectUtxos. previousUtxos is empty.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to ReselectUtxos. previousUtxos is required.");
+  }
+
+  AmountMap map_target_amount;
+  int64_t total_target = 0;
+  if (!is_elements) {
+    map_target_amount.emplace("", req->GetTargetAmount());
+  } else if (req->GetTargets().empty()) {
+    warn(CFD_LOG_SOURCE, "Failed to ReselectUtxos. targets is required.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to ReselectUtxos. targets is required.");
+  } else {
+    for (const auto& target : req->GetTargets()) {
+      map_target_amount.emplace(target.GetAsset(), target.GetAmount());
+    }
+  }
+  for (const auto& target : map_target_amount) {
+    if (target.second > 0) total_target += target.second;
+  }
+
+  // The pool stays locked until the response copies its utxo data.
+  std::shared_ptr<UtxoPool> pool;
+  std::unique_lock<std::mutex> pool_lock;
+  std::vector<Utxo> request_utxos;
+  const std::vector<Utxo>* utxo_list = &request_utxos;
+  if (req->GetUtxoPoolId() != 0) {
+    pool = UtxoPoolManager::GetInstance().GetPool(
+        req->GetUtxoPoolId(), is_elements, !req->GetUtxos().empty());
+    pool_lock = pool->GetLock();
+    utxo_list = &pool->GetUtxoList();
+  } else {
+    auto& json_utxos = req->GetUtxos();
+    request_utxos.resize(json_utxos.size());
+    auto utxo_ite = request_utxos.begin();
+    for (const auto& json_utxo : json_utxos) {
+      SelectUtxosWrapRequest::ConvertToUtxo(json_utxo, &(*utxo_ite));
+      ++utxo_ite;
+    }
+  }
+  const std::vector<Utxo>& utxos = *utxo_list;
+
+  std::vector<Utxo> previous_utxos(previous_json_utxos.size());
+  std::set<std::string> previous_outpoints;
+  auto previous_ite = previous_utxos.begin();
+  for (const auto& json_utxo : previous_json_utxos) {
+    SelectUtxosWrapRequest::ConvertToUtxo(json_utxo, &(*previous_ite));
+    previous_outpoints.insert(
+        json_utxo.GetTxid() + ":" + std::to_string(json_utxo.GetVout()));
+    ++previous_ite;
+  }
+  std::vector<bool> is_used(utxos.size(), false);
+  for (size_t index = 0; index < utxos.size(); ++index) {
+    const UtxoJsonData* json_data =
+        static_cast<const UtxoJsonData*>(utxos[index].binary_data);
+    if ((json_data != nullptr) &&
+        (previous_outpoints.count(
+             json_data->GetTxid() + ":" +
+             std::to_string(json_data->GetVout())) != 0)) {
+      is_used[index] = true;
+    }
+  }
+
+  double fee_rate = fee_info.GetFeeRate();
+  double long_term_fee_rate =
+      (fee_rate == 0) ? 0 : fee_info.GetLongTermFeeRate();
+  std::string fee_asset = (is_elements) ? fee_info.GetFeeAsset() : "";
+  // The selection state of the previous selection has the txin vsizes of
+  // the previous utxos, so their descriptors are not estimated again.
+  bool is_changeless = false;
+  std::vector<int64_t> previous_vsizes;
+  if (req->GetSelectionState().empty()) {
+    previous_vsizes = GetTxInVsizeList(previous_utxos, is_elements);
+  } else {
+    std::map<std::string, int64_t> state_vsizes =
+        ParseSelectionState(req->GetSelectionState(), &is_changeless);
+    for (const auto& json_utxo : previous_json_utxos) {
+      auto ite = state_vsizes.find(GetSelectionStateKey(
+          ByteData(json_utxo.GetTxid()), json_utxo.GetVout()));
+      if (ite == state_vsizes.end()) break;
+      previous_vsizes.push_back(ite->second);
+    }
+    if ((previous_vsizes.size() != previous_json_utxos.size()) ||
+        (state_vsizes.size() != previous_json_utxos.size())) {
+      warn(
+          CFD_LOG_SOURCE,
+          "Failed to ReselectUtxos. selectionState does not match "
+          "previousUtxos.");
+      throw CfdException(
+          CfdError::kCfdIllegalArgumentError,
+          "Failed to ReselectUtxos. selectionState does not match "
+          "previousUtxos.");
+    }
+  }
+  const std::vector<int64_t> vsizes = GetTxInVsizeList(utxos, is_elements);
+
+  // The previous utxos are kept, so only the shortfall at the new fee rate
+  // is searched among the rest.
+  AmountMap map_select_amount;
+  int64_t utxo_fee = 0;
+  UtxoColumns columns;
+  CreateUtxoColumns(
+      previous_utxos, previous_vsizes,
+      std::vector<bool>(previous_utxos.size(), false), "", &columns);
+  columns.UpdateEffectiveValues(fee_rate, long_term_fee_rate);
+  for (size_t row = 0; row < columns.GetSize(); ++row) {
+    const auto& json_utxo =
+        previous_json_utxos[columns.GetSourceIndexes()[row]];
+    map_select_amount[(is_elements) ? json_utxo.GetAsset() : ""] +=
+        columns.GetAmounts()[row];
+    utxo_fee += columns.GetFees()[row];
+  }
+
+  std::vector<uint32_t> added_indexes;
+  bool is_full_search = false;
+  int64_t fee_asset_target = 0;
+  CoinSelectionResult selection;
+  for (const auto& target : map_target_amount) {
+    if (target.first == fee_asset) {
+      fee_asset_target = (target.second > 0) ? target.second : 0;
+      continue;
+    }
+    if (target.second <= 0) continue;
+    CreateUtxoColumns(utxos, vsizes, is_used, target.first, &columns);
+    columns.UpdateEffectiveValues(fee_rate, long_term_fee_rate, false);
+    if (!CoinSelectionEngine::SelectAdditionalCoins(
+            columns, target.second - map_select_amount[target.first],
+            &selection)) {
+      is_full_search = true;
+      break;
+    }
+    added_indexes.insert(
+        added_indexes.end(), selection.indexes.begin(),
+        selection.indexes.end());
+    map_select_amount[target.first] += selection.selected_amount;
+    utxo_fee += selection.utxo_fee;
+  }
+  if (!is_full_search) {
+    int64_t fee_target = fee_asset_target;
+    if ((fee_rate != 0) || (fee_target > 0)) {
+      fee_target += fee_info.GetTxFeeAmount() + utxo_fee;
+    }
+    CreateUtxoColumns(utxos, vsizes, is_used, fee_asset, &columns);
+    columns.UpdateEffectiveValues(fee_rate, long_term_fee_rate);
+    auto select_ite = map_select_amount.find(fee_asset);
+    if (select_ite != map_select_amount.end()) {
+      fee_target -= select_ite->second;
+    }
+    bool is_selected = false;
+    if (is_changeless && (fee_target > 0)) {
+      // The previous selection has no change, so a changeless extension is
+      // searched first with the previous utxos as the fixed BnB prefix.
+      CoinSelectionParameter param;
+      param.target_value = fee_target;
+      param.cost_of_change = GetCostOfChange(fee_info, is_elements);
+      param.bnb_max_tries = req->GetBnbOption().GetMaxTries();
+      param.bnb_time_budget = req->GetBnbOption().GetTimeBudget();
+      param.bnb_thread_count = req->GetBnbOption().GetThreadCount();
+      is_selected = CoinSelectionEngine::SelectChangelessCoins(
+          columns, param, &selection);
+    }
+    if (!is_selected) {
+      is_changeless = is_changeless && (fee_target <= 0);
+      is_selected = CoinSelectionEngine::SelectAdditionalCoins(
+          columns, fee_target, &selection);
+    }
+    if (!is_selected) {
+      is_full_search = true;
+    } else if (!selection.indexes.empty()) {
+      added_indexes.insert(
+          added_indexes.end(), selection.indexes.begin(),
+          selection.indexes.end());
+      map_select_amount[fee_asset] += selection.selected_amount;
+      utxo_fee += selection.utxo_fee;
+    }
+  }
+
+  std::vector<const UtxoJsonData*> selected_list;
+  std::vector<const UtxoJsonData*> added_list;
+  std::vector<int64_t> selected_vsizes;
+  std::vector<int64_t> added_vsizes;
+  if (!is_full_search) {
+    for (const auto& json_utxo : previous_json_utxos) {
+      selected_list.push_back(&json_utxo);
+    }
+    selected_vsizes = previous_vsizes;
+    for (uint32_t index : added_indexes) {
+      added_list.push_back(
+          static_cast<const UtxoJsonData*>(utxos[index].binary_data));
+      added_vsizes.push_back(vsizes[index]);
+    }
+  } else {
+    // Fall back to the full search over the previous and the other utxos.
+    std::vector<Utxo> all_utxos(previous_utxos);
+    all_utxos.insert(all_utxos.end(), utxos.begin(), utxos.end());
+    std::vector<int64_t> all_vsizes(previous_vsizes);
+    all_vsizes.insert(all_vsizes.end(), vsizes.begin(), vsizes.end());
+    std::vector<bool> all_is_used(previous_utxos.size(), false);
+    all_is_used.insert(all_is_used.end(), is_used.begin(), is_used.end());
+    map_select_amount.clear();
+    bool is_bnb_searched = false;
+    BnbSearchStatistics bnb_statistics;
+    std::vector<uint32_t> indexes = SelectCoinsByColumns(
+        all_utxos, all_vsizes, all_is_used, map_target_amount, fee_info,
+        req->GetBnbOption(), is_elements, false, &map_select_amount,
+        &utxo_fee, &bnb_statistics, &is_bnb_searched);
+    is_changeless = is_bnb_searched && bnb_statistics.GetIsSelected();
+    for (uint32_t index : indexes) {
+      const UtxoJsonData* json_data =
+          static_cast<const UtxoJsonData*>(all_utxos[index].binary_data);
+      if (index < previous_utxos.size()) {
+        selected_list.push_back(json_data);
+        selected_vsizes.push_back(all_vsizes[index]);
+      } else {
+        added_list.push_back(json_data);
+        added_vsizes.push_back(all_vsizes[index]);
+      }
+    }
+  }
+  for (const auto* json_data : added_list) selected_list.push_back(json_data);
+  selected_vsizes.insert(
+      selected_vsizes.end(), added_vsizes.begin(), added_vsizes.end());
+  for (const auto* json_data : selected_list) {
+    res->GetUtxos().push_back(*json_data);
+  }
+  for (const auto* json_data : added_list) {
+    res->GetAddedUtxos().push_back(*json_data);
+  }
+  res->SetIsFullSearch(is_full_search);
+  res->SetSelectionState(
+      SerializeSelectionState(selected_list, selected_vsizes, is_changeless));
+
+  if (!is_elements) {
+    res->SetSelectedAmount(map_select_amount[""]);
+    res->SetIgnoreItem("selectedAmounts");
+  } else {
+    if ((fee_rate != 0) || (total_target != 0)) {
+      for (const auto& select_amount : map_select_amount) {
+        TargetAmountMapData amount_data;
+        amount_data.SetAsset(select_amount.first);
+        amount_data.SetAmount(select_amount.second);
+        res->GetSelectedAmounts().push_back(amount_data);
+      }
+    }
+    res->SetIgnoreItem("selectedAmount");
+  }
+  if (utxo_fee == 0) res->SetIgnoreItem("utxoFeeAmount");
+  res->SetUtxoFeeAmount(utxo_fee);
+  int64_t fee = fee_info.GetTxFeeAmount() + utxo_fee;
+  if ((fee_rate != 0) || (total_target != 0)) res->SetFeeAmount(fee);
+  if (fee == 0) res->SetIgnoreItem("feeAmount");
+}
+
 }  // namespace json
 }  // namespace api
 }  // namespace js
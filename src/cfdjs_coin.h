@@ -36,6 +36,31 @@ class CoinJsonApi {
   static void SelectUtxos(
       SelectUtxosWrapRequest* req, SelectUtxosWrapResponse* res);
 
+  /**
+   * @brief Select disjoint utxo sets of many payouts.
+   * @details This is a greedy approximation. The payouts are selected one
+   *     by one in descending order of the target amount, and each selection
+   *     only sees the utxos left by the larger payouts. The total fee over
+   *     all payouts is not minimized jointly.
+   * @param[in] req   request including the payout list
+   * @param[out] res  response including the selected utxo list of each payout
+   */
+  static void SelectUtxosBatch(
+      SelectUtxosBatchRequest* req, SelectUtxosBatchResponse* res);
+
+  /**
+   * @brief Re-select utxos at a new fee rate from the previous selection.
+   * @details The JSON API is stateless, so the BnB search state of the
+   *     previous selection is not reused. The previous utxos are the seed:
+   *     they are kept, and only the shortfall at the new fee rate is
+   *     selected from the rest. A full search is run only when the previous
+   *     utxos cannot be extended.
+   * @param[in] req   request including the previous utxo list
+   * @param[out] res  response including the re-selected utxo list
+   */
+  static void ReselectUtxos(
+      ReselectUtxosRequest* req, ReselectUtxosResponse* res);
+
  private:
   CoinJsonApi();
 };
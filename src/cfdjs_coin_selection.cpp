@@ -0,0 +1,709 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_coin_selection.cpp
+ *
+ * @brief Implementation of the columnar coin selection engine.
+ */
+#include "cfdjs_coin_selection.h"  // NOLINT
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "cfdjs_parallel.h"  // NOLINT
+
+namespace cfd {
+namespace js {
+namespace api {
+
+constexpr int64_t CoinSelectionEngine::kDefaultMinChange;
+
+//! knapsack random subset iteration count
+static constexpr int kKnapsackIterations = 1000;
+//! knapsack random seed (fixed for reproducible results)
+static constexpr uint32_t kKnapsackSeed = 0x63666473;
+
+// -----------------------------------------------------------------------------
+// UtxoColumns
+// -----------------------------------------------------------------------------
+/**
+ * @brief Calculate the txin fees of the vsize column.
+ * @details fee = ceil(vsize * rate / 1000). When the numerator fits in
+ *     32 bits, the loop runs on 32-bit lanes, which the compiler vectorizes
+ *     (64-bit multiply and divide have no SSE2/AVX2 vector form). Otherwise
+ *     it falls back to the scalar 64-bit loop.
+ * @param[in] vsizes      vsize column
+ * @param[in] size        row count
+ * @param[in] max_vsize   max vsize of the column
+ * @param[in] rate        fee rate (milli-satoshi/vbyte)
+ * @param[out] fees       fee column
+ */
+static void CalculateTxInFees(
+    const uint32_t* vsizes, size_t size, uint32_t max_vsize, int64_t rate,
+    int64_t* fees) {
+  static constexpr uint64_t kMaxLaneValue =
+      std::numeric_limits<uint32_t>::max();
+  if ((rate >= 0) &&
+      ((static_cast<uint64_t>(max_vsize) * static_cast<uint64_t>(rate)) <=
+       (kMaxLaneValue - 999))) {
+    const uint32_t lane_rate = static_cast<uint32_t>(rate);
+    for (size_t index = 0; index < size; ++index) {
+      fees[index] = ((vsizes[index] * lane_rate) + 999) / 1000;
+    }
+    return;
+  }
+  for (size_t index = 0; index < size; ++index) {
+    fees[index] = ((static_cast<int64_t>(vsizes[index]) * rate) + 999) / 1000;
+  }
+}
+
+UtxoColumns::UtxoColumns() : max_vsize_(0) {
+  // do nothing
+}
+
+void UtxoColumns::Clear() {
+  source_indexes_.clear();
+  amounts_.clear();
+  vsizes_.clear();
+  max_vsize_ = 0;
+  fees_.clear();
+  long_term_fees_.clear();
+  effective_values_.clear();
+}
+
+void UtxoColumns::Reserve(size_t size) {
+  source_indexes_.reserve(size);
+  amounts_.reserve(size);
+  vsizes_.reserve(size);
+  fees_.reserve(size);
+  long_term_fees_.reserve(size);
+  effective_values_.reserve(size);
+}
+
+void UtxoColumns::Add(uint32_t source_index, int64_t amount, uint32_t vsize) {
+  source_indexes_.push_back(source_index);
+  amounts_.push_back(amount);
+  vsizes_.push_back(vsize);
+  max_vsize_ = std::max(max_vsize_, vsize);
+  fees_.push_back(0);
+  long_term_fees_.push_back(0);
+  effective_values_.push_back(amount);
+}
+
+void UtxoColumns::UpdateEffectiveValues(
+    double fee_rate, double long_term_fee_rate, bool is_pay_fee) {
+  // Rates are fixed to milli-satoshi so the fees are integer arithmetic
+  // over contiguous arrays.
+  const int64_t rate = static_cast<int64_t>(std::llround(fee_rate * 1000));
+  const int64_t long_term_rate =
+      static_cast<int64_t>(std::llround(long_term_fee_rate * 1000));
+  const size_t size = amounts_.size();
+  const int64_t* amounts = amounts_.data();
+  int64_t* fees = fees_.data();
+  int64_t* effective_values = effective_values_.data();
+  CalculateTxInFees(vsizes_.data(), size, max_vsize_, rate, fees);
+  CalculateTxInFees(
+      vsizes_.data(), size, max_vsize_, long_term_rate,
+      long_term_fees_.data());
+  if (!is_pay_fee) {
+    std::copy(amounts, amounts + size, effective_values);
+    return;
+  }
+  for (size_t index = 0; index < size; ++index) {
+    effective_values[index] = amounts[index] - fees[index];
+  }
+}
+
+size_t UtxoColumns::GetSize() const { return amounts_.size(); }
+
+const std::vector<uint32_t>& UtxoColumns::GetSourceIndexes() const {
+  return source_indexes_;
+}
+
+const std::vector<int64_t>& UtxoColumns::GetAmounts() const {
+  return amounts_;
+}
+
+const std::vector<int64_t>& UtxoColumns::GetFees() const { return fees_; }
+
+const std::vector<int64_t>& UtxoColumns::GetLongTermFees() const {
+  return long_term_fees_;
+}
+
+const std::vector<int64_t>& UtxoColumns::GetEffectiveValues() const {
+  return effective_values_;
+}
+
+// -----------------------------------------------------------------------------
+// CoinSelectionEngine
+// -----------------------------------------------------------------------------
+/**
+ * @brief Set the selected rows to the selection result.
+ * @param[in] columns     utxo columns
+ * @param[in] rows        selected row list
+ * @param[in,out] result  selection result (indexes and amounts cleared)
+ */
+static void SetSelectionResult(
+    const UtxoColumns& columns, const std::vector<uint32_t>& rows,
+    CoinSelectionResult* result) {
+  const auto& source_indexes = columns.GetSourceIndexes();
+  const auto& amounts = columns.GetAmounts();
+  const auto& fees = columns.GetFees();
+  result->indexes.reserve(rows.size());
+  for (uint32_t row : rows) {
+    result->indexes.push_back(source_indexes[row]);
+    result->selected_amount += amounts[row];
+    result->utxo_fee += fees[row];
+  }
+}
+
+bool CoinSelectionEngine::SelectCoins(
+    const UtxoColumns& columns, const CoinSelectionParameter& param,
+    CoinSelectionResult* result) {
+  result->indexes.clear();
+  result->selected_amount = 0;
+  result->utxo_fee = 0;
+  result->use_bnb = false;
+  result->bnb_statistics = BnbStatistics();
+  int64_t target = param.target_value + param.fixed_fee;
+  if (target <= 0) return true;
+
+  std::vector<uint32_t> rows;
+  if (param.use_bnb &&
+      SelectCoinsBnb(
+          columns, target, param, &rows, &result->bnb_statistics)) {
+    result->use_bnb = true;
+  } else if (!SelectCoinsKnapsack(columns, target, param.min_change, &rows)) {
+    return false;
+  }
+
+  SetSelectionResult(columns, rows, result);
+  return true;
+}
+
+bool CoinSelectionEngine::SelectAdditionalCoins(
+    const UtxoColumns& columns, int64_t target, CoinSelectionResult* result) {
+  result->indexes.clear();
+  result->selected_amount = 0;
+  result->utxo_fee = 0;
+  result->use_bnb = false;
+  result->bnb_statistics = BnbStatistics();
+  if (target <= 0) return true;
+
+  const auto& effective_values = columns.GetEffectiveValues();
+  std::vector<uint32_t> candidates;
+  bool has_single = false;
+  uint32_t single = 0;
+  for (uint32_t row = 0; row < columns.GetSize(); ++row) {
+    int64_t value = effective_values[row];
+    if (value <= 0) continue;
+    candidates.push_back(row);
+    if ((value >= target) &&
+        (!has_single || (value < effective_values[single]))) {
+      has_single = true;
+      single = row;
+    }
+  }
+
+  std::vector<uint32_t> rows;
+  if (has_single) {
+    rows.push_back(single);
+  } else {
+    // The k largest values are the largest sum of k coins, so taking them
+    // in order gives the fewest coins.
+    auto compare = [&effective_values](uint32_t lhs, uint32_t rhs) -> bool {
+      if (effective_values[lhs] != effective_values[rhs]) {
+        return effective_values[lhs] < effective_values[rhs];
+      }
+      return lhs > rhs;
+    };
+    std::make_heap(candidates.begin(), candidates.end(), compare);
+    auto heap_end = candidates.end();
+    int64_t remaining = target;
+    while (true) {
+      if (heap_end == candidates.begin()) return false;
+      if (effective_values[candidates.front()] >= remaining) break;
+      std::pop_heap(candidates.begin(), heap_end, compare);
+      --heap_end;
+      rows.push_back(*heap_end);
+      remaining -= effective_values[*heap_end];
+    }
+    uint32_t last = candidates.front();
+    for (auto ite = candidates.begin(); ite != heap_end; ++ite) {
+      int64_t value = effective_values[*ite];
+      if ((value >= remaining) && ((value < effective_values[last]) ||
+                                   ((value == effective_values[last]) &&
+                                    (*ite < last)))) {
+        last = *ite;
+      }
+    }
+    rows.push_back(last);
+  }
+
+  SetSelectionResult(columns, rows, result);
+  return true;
+}
+
+bool CoinSelectionEngine::SelectChangelessCoins(
+    const UtxoColumns& columns, const CoinSelectionParameter& param,
+    CoinSelectionResult* result) {
+  result->indexes.clear();
+  result->selected_amount = 0;
+  result->utxo_fee = 0;
+  result->use_bnb = true;
+  result->bnb_statistics = BnbStatistics();
+  int64_t target = param.target_value + param.fixed_fee;
+  if (target <= 0) return true;
+
+  std::vector<uint32_t> rows;
+  if (!SelectCoinsBnb(
+          columns, target, param, &rows, &result->bnb_statistics)) {
+    return false;
+  }
+  SetSelectionResult(columns, rows, result);
+  return true;
+}
+
+std::vector<bool> CoinSelectionEngine::SelectCoinsParallel(
+    const std::vector<UtxoColumns>& columns_list,
+    const std::vector<CoinSelectionParameter>& params,
+    uint32_t thread_count, std::vector<CoinSelectionResult>* results) {
+  results->assign(columns_list.size(), CoinSelectionResult());
+  std::vector<char> is_selected(columns_list.size(), 0);
+  ParallelExecutor::Execute(
+      columns_list.size(), thread_count,
+      [&columns_list, &params, results, &is_selected](size_t index) {
+        is_selected[index] = SelectCoins(
+            columns_list[index], params[index], &(*results)[index]);
+      });
+  return std::vector<bool>(is_selected.begin(), is_selected.end());
+}
+
+/**
+ * @brief BnB search tree packed in the search order.
+ */
+struct BnbSearchTree {
+  std::vector<uint32_t> rows;       //!< column row of each depth
+  std::vector<int64_t> values;      //!< effective value (descending)
+  std::vector<int64_t> waste;       //!< fee - long-term fee
+  std::vector<int64_t> fees;        //!< fee
+  std::vector<int64_t> available;   //!< sum of values from each depth
+  int64_t target = 0;               //!< target value
+  int64_t cost_of_change = 0;       //!< exact match window
+  size_t split_depth = 0;           //!< subtree split depth
+  bool is_feerate_high = false;     //!< waste pruning flag
+};
+
+/**
+ * @brief BnB search state shared by the workers.
+ */
+struct BnbSharedState {
+  std::atomic<uint32_t> zero_waste_subtree;  //!< first zero waste subtree
+  std::atomic<int64_t> best_waste;           //!< best waste of all workers
+  std::atomic<uint64_t> tries;               //!< iteration count
+  std::atomic<bool> is_stop;                 //!< stop flag
+  std::atomic<bool> is_timeout;              //!< time budget over flag
+  uint64_t max_tries = 0;                    //!< iteration cap
+  uint32_t time_budget = 0;                  //!< time budget (msec)
+  std::chrono::steady_clock::time_point start_time;  //!< search start time
+};
+
+/**
+ * @brief BnB worker result.
+ */
+struct BnbWorkerResult {
+  std::vector<bool> selection;       //!< current selection
+  std::vector<bool> best_selection;  //!< best selection
+  int64_t best_waste = std::numeric_limits<int64_t>::max();  //!< best waste
+  uint32_t best_subtree = std::numeric_limits<uint32_t>::max();  //!< subtree
+};
+
+//! iteration count between the shared state updates
+static constexpr uint64_t kBnbTriesInterval = 256;
+//! subtree count per thread
+static constexpr uint32_t kBnbSubtreePerThread = 16;
+//! subtree split depth limit
+static constexpr size_t kBnbMaxSplitDepth = 16;
+
+/**
+ * @brief Add the iteration count, and check the stop condition.
+ * @param[in] count       iteration count
+ * @param[in,out] state   shared state
+ * @retval true   continue
+ * @retval false  stop
+ */
+static bool UpdateBnbTries(uint64_t count, BnbSharedState* state) {
+  uint64_t tries = state->tries.fetch_add(count) + count;
+  if (tries >= state->max_tries) {
+    state->is_stop = true;
+  } else if (state->time_budget != 0) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - state->start_time);
+    if (elapsed.count() >= state->time_budget) {
+      state->is_timeout = true;
+      state->is_stop = true;
+    }
+  }
+  return !state->is_stop;
+}
+
+/**
+ * @brief Record a solution of the subtree.
+ * @details On the same waste, a later solution of the same subtree wins
+ *     (same as the sequential search), and an earlier subtree wins between
+ *     subtrees, so the result does not depend on the thread timing.
+ * @param[in] subtree     subtree index
+ * @param[in] waste       waste of the solution
+ * @param[in,out] state   shared state
+ * @param[in,out] result  worker result
+ */
+static void RecordBnbSolution(
+    uint32_t subtree, int64_t waste, BnbSharedState* state,
+    BnbWorkerResult* result) {
+  if ((waste > result->best_waste) ||
+      ((waste == result->best_waste) && (subtree != result->best_subtree))) {
+    return;
+  }
+  result->best_selection = result->selection;
+  result->best_waste = waste;
+  result->best_subtree = subtree;
+  int64_t best_waste = state->best_waste.load();
+  while ((waste < best_waste) &&
+         !state->best_waste.compare_exchange_weak(best_waste, waste)) {
+    // retry
+  }
+  if (waste == 0) {
+    uint32_t zero_subtree = state->zero_waste_subtree.load();
+    while ((subtree < zero_subtree) &&
+           !state->zero_waste_subtree.compare_exchange_weak(
+               zero_subtree, subtree)) {
+      // retry
+    }
+  }
+}
+
+/**
+ * @brief Search a subtree by BnB.
+ * @param[in] tree        search tree
+ * @param[in] subtree     subtree index (bit on: exclude, from the top)
+ * @param[in,out] state   shared state
+ * @param[in,out] result  worker result
+ */
+static void SearchBnbSubtree(
+    const BnbSearchTree& tree, uint32_t subtree, BnbSharedState* state,
+    BnbWorkerResult* result) {
+  const size_t depth = tree.split_depth;
+  const int64_t target = tree.target;
+  const int64_t max_value = tree.target + tree.cost_of_change;
+  std::vector<bool>& selection = result->selection;
+  selection.clear();
+  int64_t current_value = 0;
+  int64_t current_waste = 0;
+
+  // follow the subtree prefix with the same checks as the search loop
+  for (size_t index = 0; index < depth; ++index) {
+    if ((current_value + tree.available[index] < target) ||
+        (current_value > max_value) ||
+        ((current_waste > state->best_waste.load()) &&
+         tree.is_feerate_high)) {
+      return;
+    }
+    if (current_value >= target) {
+      // solution above the split depth: only the all-exclude subtree has it
+      uint32_t rest_mask = (1U << (depth - index)) - 1;
+      if ((subtree & rest_mask) == rest_mask) {
+        RecordBnbSolution(
+            subtree, current_waste + current_value - target, state, result);
+      }
+      return;
+    }
+    bool is_include = ((subtree >> (depth - 1 - index)) & 1) == 0;
+    if (is_include && (index > 0) && !selection.back() &&
+        (tree.values[index] == tree.values[index - 1]) &&
+        (tree.fees[index] == tree.fees[index - 1])) {
+      return;  // same as the subtree excluding this utxo
+    }
+    selection.push_back(is_include);
+    if (is_include) {
+      current_value += tree.values[index];
+      current_waste += tree.waste[index];
+    }
+  }
+
+  uint64_t tries = 0;
+  while (true) {
+    if (++tries == kBnbTriesInterval) {
+      tries = 0;
+      if (!UpdateBnbTries(kBnbTriesInterval, state)) return;
+      if (subtree > state->zero_waste_subtree.load()) return;
+    }
+
+    bool backtrack = false;
+    if ((current_value + tree.available[selection.size()] < target) ||
+        (current_value > max_value) ||
+        ((current_waste > state->best_waste.load()) &&
+         tree.is_feerate_high)) {
+      backtrack = true;
+    } else if (current_value >= target) {
+      int64_t waste = current_waste + current_value - target;
+      RecordBnbSolution(subtree, waste, state, result);
+      if (waste == 0) break;
+      backtrack = true;
+    }
+
+    if (backtrack) {
+      while ((selection.size() > depth) && !selection.back()) {
+        selection.pop_back();
+      }
+      if (selection.size() == depth) break;
+      size_t last = selection.size() - 1;
+      selection.back() = false;
+      current_value -= tree.values[last];
+      current_waste -= tree.waste[last];
+    } else {
+      size_t next = selection.size();
+      // skip an equivalent utxo of the previously excluded one
+      if ((next > 0) && !selection.back() &&
+          (tree.values[next] == tree.values[next - 1]) &&
+          (tree.fees[next] == tree.fees[next - 1])) {
+        selection.push_back(false);
+      } else {
+        selection.push_back(true);
+        current_value += tree.values[next];
+        current_waste += tree.waste[next];
+      }
+    }
+  }
+  UpdateBnbTries(tries, state);
+}
+
+bool CoinSelectionEngine::SelectCoinsBnb(
+    const UtxoColumns& columns, int64_t target,
+    const CoinSelectionParameter& param, std::vector<uint32_t>* rows,
+    BnbStatistics* statistics) {
+  const auto& effective_values = columns.GetEffectiveValues();
+  const auto& fees = columns.GetFees();
+  const auto& long_term_fees = columns.GetLongTermFees();
+  auto start_time = std::chrono::steady_clock::now();
+  *statistics = BnbStatistics();
+
+  // candidate rows ordered by effective value (descending)
+  BnbSearchTree tree;
+  std::vector<uint32_t>& order = tree.rows;
+  order.reserve(columns.GetSize());
+  int64_t available_value = 0;
+  for (uint32_t row = 0; row < columns.GetSize(); ++row) {
+    if (effective_values[row] > 0) {
+      order.push_back(row);
+      available_value += effective_values[row];
+    }
+  }
+  if (available_value < target) return false;
+  std::stable_sort(
+      order.begin(), order.end(),
+      [&effective_values](uint32_t lhs, uint32_t rhs) -> bool {
+        return effective_values[lhs] > effective_values[rhs];
+      });
+
+  // pack the search columns in the search order
+  const size_t size = order.size();
+  tree.values.resize(size);
+  tree.waste.resize(size);
+  tree.fees.resize(size);
+  tree.available.resize(size + 1);
+  for (size_t index = 0; index < size; ++index) {
+    tree.values[index] = effective_values[order[index]];
+    tree.fees[index] = fees[order[index]];
+    tree.waste[index] = fees[order[index]] - long_term_fees[order[index]];
+  }
+  tree.available[size] = 0;
+  for (size_t index = size; index > 0; --index) {
+    tree.available[index - 1] = tree.available[index] + tree.values[index - 1];
+  }
+  tree.target = target;
+  tree.cost_of_change = param.cost_of_change;
+  tree.is_feerate_high = (size > 0) && (tree.waste[0] > 0);
+
+  // the split depth is decided before the subtree count caps the threads.
+  uint32_t thread_count = ParallelExecutor::GetThreadCount(
+      param.bnb_thread_count, std::numeric_limits<size_t>::max());
+  while ((thread_count > 1) && (tree.split_depth < kBnbMaxSplitDepth) &&
+         (tree.split_depth < size) &&
+         ((1U << tree.split_depth) < thread_count * kBnbSubtreePerThread)) {
+    ++tree.split_depth;
+  }
+  const uint32_t subtree_count = 1U << tree.split_depth;
+  thread_count = ParallelExecutor::GetThreadCount(thread_count, subtree_count);
+
+  BnbSharedState state;
+  state.zero_waste_subtree = std::numeric_limits<uint32_t>::max();
+  state.best_waste = std::numeric_limits<int64_t>::max();
+  state.tries = 0;
+  state.is_stop = false;
+  state.is_timeout = false;
+  state.max_tries = param.bnb_max_tries;
+  state.time_budget = param.bnb_time_budget;
+  state.start_time = start_time;
+
+  // allocate before starting the workers
+  std::vector<BnbWorkerResult> results(thread_count);
+  for (auto& result : results) {
+    result.selection.reserve(size);
+    result.best_selection.reserve(size);
+  }
+  ParallelExecutor::ExecuteWithWorker(
+      subtree_count, thread_count,
+      [&tree, &state, &results](size_t subtree, uint32_t worker) {
+        // subtrees are taken in order, so the rest are also skipped.
+        if (state.is_stop || (subtree > state.zero_waste_subtree.load())) {
+          return;
+        }
+        SearchBnbSubtree(
+            tree, static_cast<uint32_t>(subtree), &state, &results[worker]);
+      });
+
+  // same waste: the earlier subtree wins, independent of the worker.
+  const BnbWorkerResult* best = nullptr;
+  for (const auto& result : results) {
+    if (result.best_selection.empty()) continue;
+    if ((best == nullptr) || (result.best_waste < best->best_waste) ||
+        ((result.best_waste == best->best_waste) &&
+         (result.best_subtree < best->best_subtree))) {
+      best = &result;
+    }
+  }
+
+  statistics->tries = state.tries;
+  statistics->elapsed_time = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start_time)
+          .count());
+  statistics->thread_count = thread_count;
+  statistics->subtree_count = subtree_count;
+  statistics->is_timeout = state.is_timeout;
+  statistics->is_completed = !state.is_stop;
+
+  if (best == nullptr) return false;
+  rows->clear();
+  for (size_t index = 0; index < best->best_selection.size(); ++index) {
+    if (best->best_selection[index]) rows->push_back(order[index]);
+  }
+  return true;
+}
+
+/**
+ * @brief Find a subset close to the target by random passes.
+ * @param[in] values        candidate values (descending)
+ * @param[in] total_lower   sum of values
+ * @param[in] target        target value
+ * @param[out] best         best subset flags
+ * @param[out] best_value   best subset value
+ */
+static void ApproximateBestSubset(
+    const std::vector<int64_t>& values, int64_t total_lower, int64_t target,
+    std::vector<char>* best, int64_t* best_value) {
+  std::vector<char> included;
+  best->assign(values.size(), 1);
+  *best_value = total_lower;
+  std::mt19937 random(kKnapsackSeed);
+
+  for (int rep = 0; (rep < kKnapsackIterations) && (*best_value != target);
+       ++rep) {
+    included.assign(values.size(), 0);
+    int64_t total = 0;
+    bool is_reached = false;
+    for (int pass = 0; (pass < 2) && !is_reached; ++pass) {
+      for (size_t index = 0; index < values.size(); ++index) {
+        bool is_pick =
+            (pass == 0) ? ((random() & 1) != 0) : (included[index] == 0);
+        if (!is_pick) continue;
+        total += values[index];
+        included[index] = 1;
+        if (total >= target) {
+          is_reached = true;
+          if (total < *best_value) {
+            *best_value = total;
+            *best = included;
+          }
+          total -= values[index];
+          included[index] = 0;
+        }
+      }
+    }
+  }
+}
+
+bool CoinSelectionEngine::SelectCoinsKnapsack(
+    const UtxoColumns& columns, int64_t target, int64_t min_change,
+    std::vector<uint32_t>* rows) {
+  const auto& effective_values = columns.GetEffectiveValues();
+  rows->clear();
+
+  std::vector<uint32_t> applicable;
+  int64_t total_lower = 0;
+  bool has_lowest_larger = false;
+  uint32_t lowest_larger = 0;
+  for (uint32_t row = 0; row < columns.GetSize(); ++row) {
+    int64_t value = effective_values[row];
+    if (value <= 0) continue;
+    if (value == target) {
+      rows->push_back(row);
+      return true;
+    } else if (value < target + min_change) {
+      applicable.push_back(row);
+      total_lower += value;
+    } else if (
+        !has_lowest_larger || (value < effective_values[lowest_larger])) {
+      has_lowest_larger = true;
+      lowest_larger = row;
+    }
+  }
+
+  if (total_lower == target) {
+    *rows = applicable;
+    return true;
+  }
+  if (total_lower < target) {
+    if (!has_lowest_larger) return false;
+    rows->push_back(lowest_larger);
+    return true;
+  }
+
+  std::stable_sort(
+      applicable.begin(), applicable.end(),
+      [&effective_values](uint32_t lhs, uint32_t rhs) -> bool {
+        return effective_values[lhs] > effective_values[rhs];
+      });
+  std::vector<int64_t> values(applicable.size());
+  for (size_t index = 0; index < applicable.size(); ++index) {
+    values[index] = effective_values[applicable[index]];
+  }
+
+  std::vector<char> best;
+  int64_t best_value = 0;
+  ApproximateBestSubset(values, total_lower, target, &best, &best_value);
+  if ((best_value != target) && (total_lower >= target + min_change)) {
+    ApproximateBestSubset(
+        values, total_lower, target + min_change, &best, &best_value);
+  }
+
+  if (has_lowest_larger &&
+      (((best_value != target) && (best_value < target + min_change)) ||
+       (effective_values[lowest_larger] <= best_value))) {
+    rows->push_back(lowest_larger);
+  } else {
+    for (size_t index = 0; index < applicable.size(); ++index) {
+      if (best[index] != 0) rows->push_back(applicable[index]);
+    }
+  }
+  return true;
+}
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
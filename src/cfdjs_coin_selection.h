@@ -0,0 +1,250 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_coin_selection.h
+ *
+ * @brief Definition of the columnar coin selection engine.
+ */
+#ifndef CFD_JS_SRC_CFDJS_COIN_SELECTION_H_
+#define CFD_JS_SRC_CFDJS_COIN_SELECTION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cfd {
+namespace js {
+namespace api {
+
+/**
+ * @brief Coin selection parameter.
+ */
+struct CoinSelectionParameter {
+  int64_t target_value = 0;         //!< target amount (excluding fee)
+  int64_t fixed_fee = 0;            //!< tx fee excluding txins
+  int64_t cost_of_change = 0;       //!< BnB exact match window
+  int64_t min_change = 0;           //!< knapsack minimum change
+  bool use_bnb = true;              //!< enable BnB
+  uint32_t bnb_max_tries = 100000;  //!< BnB iteration cap (all threads)
+  uint32_t bnb_time_budget = 0;     //!< BnB time budget (msec, 0: none)
+  uint32_t bnb_thread_count = 1;    //!< BnB threads (0: hardware threads)
+};
+
+/**
+ * @brief BnB search statistics.
+ */
+struct BnbStatistics {
+  uint64_t tries = 0;          //!< search iteration count
+  uint64_t elapsed_time = 0;   //!< elapsed time (microseconds)
+  uint32_t thread_count = 0;   //!< worker thread count
+  uint32_t subtree_count = 0;  //!< split subtree count
+  bool is_timeout = false;     //!< stopped by the time budget
+  bool is_completed = false;   //!< whole search tree explored
+};
+
+/**
+ * @brief Coin selection result.
+ */
+struct CoinSelectionResult {
+  std::vector<uint32_t> indexes;  //!< selected source indexes
+  int64_t selected_amount = 0;    //!< selected amount
+  int64_t utxo_fee = 0;           //!< fee of the selected txins
+  bool use_bnb = false;           //!< selected by BnB
+  BnbStatistics bnb_statistics;   //!< BnB search statistics
+};
+
+/**
+ * @brief Structure-of-arrays utxo columns.
+ * @details Only the fields touched by the selection loops are kept, in
+ *     contiguous arrays, so the search does not walk the fat Utxo records.
+ */
+class UtxoColumns {
+ public:
+  /**
+   * @brief constructor.
+   */
+  UtxoColumns();
+
+  /**
+   * @brief Clear all rows.
+   */
+  void Clear();
+  /**
+   * @brief Reserve rows.
+   * @param[in] size    row count
+   */
+  void Reserve(size_t size);
+  /**
+   * @brief Add a row.
+   * @param[in] source_index  index of the source utxo list
+   * @param[in] amount        satoshi amount
+   * @param[in] vsize         txin virtual size
+   */
+  void Add(uint32_t source_index, int64_t amount, uint32_t vsize);
+  /**
+   * @brief Recompute fees and effective values of all rows.
+   * @param[in] fee_rate            effective fee rate (satoshi/vbyte)
+   * @param[in] long_term_fee_rate  long-term fee rate (satoshi/vbyte)
+   * @param[in] is_pay_fee          false: the fee is paid by another asset,
+   *     so the effective value is the amount.
+   */
+  void UpdateEffectiveValues(
+      double fee_rate, double long_term_fee_rate, bool is_pay_fee = true);
+
+  /**
+   * @brief Get the row count.
+   * @return row count
+   */
+  size_t GetSize() const;
+  /**
+   * @brief Get the source index column.
+   * @return source index column
+   */
+  const std::vector<uint32_t>& GetSourceIndexes() const;
+  /**
+   * @brief Get the amount column.
+   * @return amount column
+   */
+  const std::vector<int64_t>& GetAmounts() const;
+  /**
+   * @brief Get the txin fee column.
+   * @return txin fee column
+   */
+  const std::vector<int64_t>& GetFees() const;
+  /**
+   * @brief Get the long-term txin fee column.
+   * @return long-term txin fee column
+   */
+  const std::vector<int64_t>& GetLongTermFees() const;
+  /**
+   * @brief Get the effective value column.
+   * @return effective value column
+   */
+  const std::vector<int64_t>& GetEffectiveValues() const;
+
+ private:
+  std::vector<uint32_t> source_indexes_;   //!< source utxo index
+  std::vector<int64_t> amounts_;           //!< amount
+  std::vector<uint32_t> vsizes_;           //!< txin vsize
+  uint32_t max_vsize_;                     //!< max txin vsize
+  std::vector<int64_t> fees_;              //!< txin fee
+  std::vector<int64_t> long_term_fees_;    //!< long-term txin fee
+  std::vector<int64_t> effective_values_;  //!< amount - fee
+};
+
+/**
+ * @brief Coin selection over utxo columns.
+ * @details BnB is tried first, and knapsack is used as the fallback.
+ */
+class CoinSelectionEngine {
+ public:
+  //! knapsack minimum change default (same as bitcoin core)
+  static constexpr int64_t kDefaultMinChange = 1000000;
+
+  /**
+   * @brief Select coins.
+   * @param[in] columns   utxo columns (effective values updated)
+   * @param[in] param     selection parameter
+   * @param[out] result   selection result
+   * @retval true   selected
+   * @retval false  insufficient funds
+   */
+  static bool SelectCoins(
+      const UtxoColumns& columns, const CoinSelectionParameter& param,
+      CoinSelectionResult* result);
+
+  /**
+   * @brief Select coins of independent targets concurrently.
+   * @details Each target is selected by SelectCoins on its own columns.
+   *     On wasm, all targets are selected on the calling thread.
+   * @param[in] columns_list  utxo columns of each target
+   * @param[in] params        selection parameter of each target
+   * @param[in] thread_count  thread count (0: hardware threads)
+   * @param[out] results      selection result of each target
+   * @return selected flag of each target
+   */
+  static std::vector<bool> SelectCoinsParallel(
+      const std::vector<UtxoColumns>& columns_list,
+      const std::vector<CoinSelectionParameter>& params,
+      uint32_t thread_count, std::vector<CoinSelectionResult>* results);
+
+  /**
+   * @brief Select the fewest coins covering the target.
+   * @details Used to extend a previous selection. The largest effective
+   *     values are taken first, and the last coin is the smallest one that
+   *     still covers the rest of the target.
+   * @param[in] columns   utxo columns (effective values updated)
+   * @param[in] target    effective value to add
+   * @param[out] result   selection result (use_bnb is always false)
+   * @retval true   selected
+   * @retval false  insufficient funds
+   */
+  static bool SelectAdditionalCoins(
+      const UtxoColumns& columns, int64_t target,
+      CoinSelectionResult* result);
+
+  /**
+   * @brief Select coins covering the target without a change by BnB.
+   * @details Used to extend a previous selection that has no change. The
+   *     previous utxos are the fixed prefix of the search tree, so only the
+   *     shortfall is searched among the columns. There is no knapsack
+   *     fallback.
+   * @param[in] columns   utxo columns (effective values updated)
+   * @param[in] param     selection parameter (target_value is the shortfall)
+   * @param[out] result   selection result
+   * @retval true   selected
+   * @retval false  no changeless selection
+   */
+  static bool SelectChangelessCoins(
+      const UtxoColumns& columns, const CoinSelectionParameter& param,
+      CoinSelectionResult* result);
+
+  /**
+   * @brief Select coins by Branch and Bound.
+   * @details The search tree is split into subtrees by the decisions of the
+   *     first utxos, and worker threads take the subtrees in order. When the
+   *     iteration cap or the time budget is reached, the best solution found
+   *     so far is returned.
+   *     Between solutions of the same waste, the one of the earlier subtree
+   *     is returned, whichever thread found it. So a search that runs to the
+   *     end returns the same rows for any thread timing. The split depends
+   *     on the thread count, so such a tie may be resolved differently on
+   *     another thread count.
+   *     A search stopped by the iteration cap or the time budget is not
+   *     deterministic with several threads: the iterations are shared by the
+   *     threads, so the explored subtrees depend on the thread timing. The
+   *     time budget depends on the timing even on a single thread.
+   * @param[in] columns     utxo columns
+   * @param[in] target      target value (including fixed fee)
+   * @param[in] param       selection parameter (cost_of_change, bnb_*)
+   * @param[out] rows       selected row list
+   * @param[out] statistics search statistics
+   * @retval true   found
+   * @retval false  not found
+   */
+  static bool SelectCoinsBnb(
+      const UtxoColumns& columns, int64_t target,
+      const CoinSelectionParameter& param, std::vector<uint32_t>* rows,
+      BnbStatistics* statistics);
+
+  /**
+   * @brief Select coins by knapsack.
+   * @param[in] columns     utxo columns
+   * @param[in] target      target value (including fixed fee)
+   * @param[in] min_change  minimum change
+   * @param[out] rows       selected row list
+   * @retval true   found
+   * @retval false  insufficient funds
+   */
+  static bool SelectCoinsKnapsack(
+      const UtxoColumns& columns, int64_t target, int64_t min_change,
+      std::vector<uint32_t>* rows);
+
+ private:
+  CoinSelectionEngine();
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_SRC_CFDJS_COIN_SELECTION_H_
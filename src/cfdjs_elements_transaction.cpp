@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>  // NOLINT
 #include <set>
 #include <string>
 #include <vector>
@@ -22,6 +24,7 @@
 #include "cfd_js_api_json_autogen.h"  // NOLINT
 #include "cfdcore/cfdcore_descriptor.h"
 #include "cfdcore/cfdcore_taproot.h"
+#include "cfdcore/cfdcore_transaction.h"
 #include "cfdcore/cfdcore_util.h"
 #include "cfdjs/cfdjs_api_address.h"
 #include "cfdjs/cfdjs_api_elements_address.h"
@@ -29,7 +32,12 @@
 #include "cfdjs_address_base.h"               // NOLINT
 #include "cfdjs_internal.h"                   // NOLINT
 #include "cfdjs_json_elements_transaction.h"  // NOLINT
+#include "cfdjs_parallel.h"                   // NOLINT
+#include "cfdjs_slip77.h"                     // NOLINT
+#include "cfdjs_size_estimator.h"             // NOLINT
 #include "cfdjs_transaction_base.h"           // NOLINT
+#include "cfdjs_txoutproof.h"                 // NOLINT
+#include "cfdjs_utxo_pool.h"                  // NOLINT
 
 namespace cfd {
 namespace js {
@@ -90,6 +98,7 @@ using cfd::core::Script;
 using cfd::core::ScriptElement;
 using cfd::core::SigHashType;
 using cfd::core::TaprootUtil;
+using cfd::core::Transaction;
 using cfd::core::Txid;
 using cfd::core::logger::info;
 using cfd::core::logger::warn;
@@ -133,6 +142,361 @@ struct Issuance {
   }
 };
 
+/**
+ * @brief Get the location of an output proof in the transaction.
+ * @param[in] proof           proof data
+ * @param[in,out] offset      offset of the proof field (moved to the next)
+ * @param[out] proof_offset   offset of the proof data
+ * @param[out] proof_size     proof data size
+ * @param[out] proof_hash     sha256 hash of the proof data
+ * @retval true   proof exists
+ * @retval false  empty proof
+ */
+static bool GetProofLocation(
+    const ByteData& proof, uint32_t* offset, uint32_t* proof_offset,
+    uint32_t* proof_size, std::string* proof_hash) {
+  uint32_t size = static_cast<uint32_t>(proof.GetDataSize());
+  *offset += TxSizeEstimator::GetVarIntSize(size);
+  *proof_offset = *offset;
+  *proof_size = size;
+  *offset += size;
+  if (size == 0) return false;
+  *proof_hash = HashUtil::Sha256(proof).GetHex();
+  return true;
+}
+
+/**
+ * @brief Output matched by ScanAndUnblind.
+ */
+struct ScanUnblindTarget {
+  Txid txid;                  //!< txid
+  uint32_t vout = 0;          //!< vout
+  Script locking_script;      //!< locking script
+  ConfidentialAssetId asset;  //!< asset (or commitment)
+  ConfidentialValue value;    //!< value (or commitment)
+  ConfidentialNonce nonce;    //!< nonce
+  ByteData range_proof;       //!< rangeproof
+  Privkey blinding_key;       //!< blinding key
+};
+
+/**
+ * @brief Mainchain transaction of peg-in claims. (parsed once per batch)
+ */
+struct PeginMainchainTxData {
+  ByteData tx;                   //!< mainchain transaction for the witness
+  Txid txid;                     //!< mainchain txid
+  std::vector<int64_t> amounts;  //!< mainchain txout amounts
+};
+
+/**
+ * @brief Get the key of the mainchain transaction map.
+ * @param[in] txin    peg-in txin
+ * @return map key
+ */
+static std::string GetPeginMainchainTxKey(
+    const ElementsPeginTxInStruct& txin) {
+  return std::string(txin.is_remove_mainchain_tx_witness ? "1" : "0") +
+         txin.peginwitness.mainchain_raw_transaction;
+}
+
+/**
+ * @brief Parsed txoutproof of peg-in claims.
+ */
+struct PeginTxOutProofData {
+  std::string proof;          //!< txoutproof hex
+  size_t block_index = 0;     //!< index of the block hash list
+  std::set<std::string> txids;  //!< txids proven by the txoutproof
+};
+
+/**
+ * @brief Create the peg-in transaction.
+ * @param[in] request           create request
+ * @param[in] mainchain_tx_map  parsed mainchain transactions (nullptr: parse)
+ * @return transaction data
+ */
+static RawTransactionResponseStruct CreatePeginTransactionByRequest(
+    const CreateRawPeginRequestStruct& request,
+    const std::map<std::string, PeginMainchainTxData>* mainchain_tx_map) {
+  RawTransactionResponseStruct response;
+  // Transaction作成
+  std::vector<ConfidentialTxIn> txins;
+  std::vector<ConfidentialTxOut> txouts;
+  std::vector<TxInPeginParameters> pegins;
+
+  // TxInの追加
+  for (const auto& txin_req : request.txins) {
+    Txid txid(txin_req.txid);
+    txins.emplace_back(txid, txin_req.vout, txin_req.sequence);
+
+    // PeginWitnessの追加
+    if (txin_req.is_pegin) {
+      info(
+          CFD_LOG_SOURCE, "rm btcWitness[{}]",
+          txin_req.is_remove_mainchain_tx_witness);
+      TxInPeginParameters pegin_data;
+      pegin_data.txid = txid;
+      pegin_data.vout = txin_req.vout;
+      pegin_data.amount =
+          Amount::CreateBySatoshiAmount(txin_req.peginwitness.amount);
+      pegin_data.asset = ConfidentialAssetId(txin_req.peginwitness.asset);
+      pegin_data.mainchain_blockhash =
+          BlockHash(txin_req.peginwitness.mainchain_genesis_block_hash);
+      pegin_data.claim_script = Script(txin_req.peginwitness.claim_script);
+      if (mainchain_tx_map != nullptr) {
+        pegin_data.mainchain_raw_tx =
+            mainchain_tx_map->at(GetPeginMainchainTxKey(txin_req)).tx;
+      } else {
+        pegin_data.mainchain_raw_tx =
+            ConfidentialTransaction::GetBitcoinTransaction(
+                ByteData(txin_req.peginwitness.mainchain_raw_transaction),
+                txin_req.is_remove_mainchain_tx_witness);
+      }
+      pegin_data.mainchain_txoutproof =
+          ByteData(txin_req.peginwitness.mainchain_txoutproof);
+      pegins.push_back(pegin_data);
+    }
+  }
+
+  // TxOutの追加
+  ElementsAddressFactory address_factory;
+  Script script;
+  for (const auto& txout_req : request.txouts) {
+    const std::string& addr = txout_req.address;
+    Amount amount(Amount::CreateBySatoshiAmount(txout_req.amount));
+    ConfidentialAssetId asset(txout_req.asset);
+    if (!txout_req.direct_locking_script.empty()) {
+      txouts.emplace_back(
+          Script(txout_req.direct_locking_script), asset,
+          ConfidentialValue(amount),
+          ConfidentialNonce(txout_req.direct_nonce), ByteData(), ByteData());
+    } else {
+      if (ElementsConfidentialAddress::IsConfidentialAddress(addr)) {
+        ElementsConfidentialAddress confidential_addr(addr);
+        if (txout_req.is_remove_nonce) {
+          txouts.emplace_back(
+              confidential_addr.GetUnblindedAddress(), asset, amount);
+        } else {
+          txouts.emplace_back(confidential_addr, asset, amount);
+        }
+      } else {
+        ConfidentialTxOut txout(
+            address_factory.GetAddress(addr), asset, amount);
+        txout.SetNonce(ConfidentialNonce(txout_req.direct_nonce));
+        txouts.emplace_back(txout);
+      }
+    }
+  }
+
+  // feeの追加
+  ConfidentialTxOut txout_fee;
+  // amountが0のfeeは無効と判定
+  if (request.fee.amount != 0) {
+    txout_fee = ConfidentialTxOut(
+        ConfidentialAssetId(request.fee.asset),
+        Amount::CreateBySatoshiAmount(request.fee.amount));
+  }
+
+  ElementsTransactionApi api;
+  ConfidentialTransactionController ctxc = api.CreateRawPeginTransaction(
+      request.version, request.locktime, txins, pegins, txouts, txout_fee);
+
+  // すべて設定後にTxoutのRandomSort
+  if (request.is_random_sort_tx_out) {
+    ctxc.RandomSortTxOut();
+  }
+
+  response.hex = ctxc.GetHex();
+  return response;
+}
+
+/**
+ * @brief Create the issuance txout.
+ * @param[in] address           send address
+ * @param[in] amount            amount
+ * @param[in] is_remove_nonce   remove nonce flag
+ * @param[in] address_factory   address factory
+ * @return txout (the asset is set by the issuance)
+ */
+static ConfidentialTxOut CreateIssuanceTxOut(
+    const std::string& address, const Amount& amount, bool is_remove_nonce,
+    const ElementsAddressFactory& address_factory) {
+  if (ElementsConfidentialAddress::IsConfidentialAddress(address)) {
+    ElementsConfidentialAddress confidential_addr(address);
+    if (is_remove_nonce) {
+      return ConfidentialTxOut(
+          confidential_addr.GetUnblindedAddress(), ConfidentialAssetId(),
+          amount);
+    }
+    return ConfidentialTxOut(confidential_addr, ConfidentialAssetId(), amount);
+  }
+  return ConfidentialTxOut(
+      address_factory.GetAddress(address), ConfidentialAssetId(), amount);
+}
+
+/**
+ * @brief Create the issuance parameters.
+ * @param[in] issuances   issuance request list
+ * @return issuance parameters
+ */
+static std::vector<TxInIssuanceParameters> CreateIssuanceParameters(
+    const std::vector<IssuanceDataRequestStruct>& issuances) {
+  ElementsAddressFactory address_factory;
+  std::vector<TxInIssuanceParameters> issuance_param;
+  issuance_param.reserve(issuances.size());
+  for (const auto& issuance : issuances) {
+    TxInIssuanceParameters param;
+    param.txid = Txid(issuance.txid);
+    param.vout = issuance.vout;
+    param.asset_amount = Amount::CreateBySatoshiAmount(issuance.asset_amount);
+    param.asset_txout = CreateIssuanceTxOut(
+        issuance.asset_address, param.asset_amount, issuance.is_remove_nonce,
+        address_factory);
+    param.token_amount = Amount::CreateBySatoshiAmount(issuance.token_amount);
+    param.token_txout = CreateIssuanceTxOut(
+        issuance.token_address, param.token_amount, issuance.is_remove_nonce,
+        address_factory);
+    if (!issuance.contract_hash.empty()) {
+      param.contract_hash = ByteData256(issuance.contract_hash);
+    }
+    param.is_blind = issuance.is_blind;
+    issuance_param.push_back(param);
+  }
+  return issuance_param;
+}
+
+/**
+ * @brief Create the reissuance parameters.
+ * @param[in] issuances   reissuance request list
+ * @return reissuance parameters
+ */
+static std::vector<TxInReissuanceParameters> CreateReissuanceParameters(
+    const std::vector<ReissuanceDataRequestStruct>& issuances) {
+  ElementsAddressFactory address_factory;
+  std::vector<TxInReissuanceParameters> reissuance_param;
+  reissuance_param.reserve(issuances.size());
+  for (const auto& issuance : issuances) {
+    TxInReissuanceParameters param;
+    param.txid = Txid(issuance.txid);
+    param.vout = issuance.vout;
+    param.amount = Amount::CreateBySatoshiAmount(issuance.amount);
+    param.asset_txout = CreateIssuanceTxOut(
+        issuance.address, param.amount, issuance.is_remove_nonce,
+        address_factory);
+    param.blind_factor = BlindFactor(issuance.asset_blinding_nonce);
+    param.entropy = BlindFactor(issuance.asset_entropy);
+    reissuance_param.push_back(param);
+  }
+  return reissuance_param;
+}
+
+/**
+ * @brief Convert the issuance output.
+ * @param[in] output          issuance output
+ * @param[in] is_reissuance   reissuance flag (token is not output)
+ * @return issuance data
+ */
+static IssuanceDataResponseStruct ConvertIssuanceOutput(
+    const IssuanceOutput& output, bool is_reissuance) {
+  IssuanceDataResponseStruct res_issuance;
+  res_issuance.txid = output.txid.GetHex();
+  res_issuance.vout = output.vout;
+  res_issuance.asset = output.output.asset.GetHex();
+  res_issuance.entropy = output.output.entropy.GetHex();
+  if (is_reissuance) {
+    res_issuance.ignore_items.insert("token");
+  } else {
+    res_issuance.token = output.output.token.GetHex();
+  }
+  return res_issuance;
+}
+
+/**
+ * @brief Set the issuances and reissuances to the transaction.
+ * @param[in] request   issuance request
+ * @return transaction and issuance data
+ */
+static SetRawIssuanceResponseStruct SetIssuanceByRequest(
+    const SetRawIssuanceRequestStruct& request) {
+  if (request.issuances.empty() && request.reissuances.empty()) {
+    warn(
+        CFD_LOG_SOURCE, "Failed to SetRawIssuanceBatch. issuance is empty.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "issuances and reissuances are empty.");
+  }
+
+  // Both lists are set on one controller, so the transaction is parsed once.
+  ConfidentialTransactionController ctxc(request.tx);
+  SetRawIssuanceResponseStruct response;
+  for (const auto& param : CreateIssuanceParameters(request.issuances)) {
+    IssuanceOutput output;
+    output.txid = param.txid;
+    output.vout = param.vout;
+    output.output = ctxc.SetAssetIssuance(
+        param.txid, param.vout, param.asset_amount, param.asset_txout,
+        param.token_amount, param.token_txout, param.is_blind,
+        param.contract_hash, false);
+    response.issuances.push_back(ConvertIssuanceOutput(output, false));
+  }
+  for (const auto& param : CreateReissuanceParameters(request.reissuances)) {
+    IssuanceOutput output;
+    output.txid = param.txid;
+    output.vout = param.vout;
+    output.output = ctxc.SetAssetReissuance(
+        param.txid, param.vout, param.amount, param.asset_txout,
+        param.blind_factor, param.entropy, false);
+    response.reissuances.push_back(ConvertIssuanceOutput(output, true));
+  }
+
+  // すべて設定後にTxoutのRandomSort
+  if (request.is_random_sort_tx_out) {
+    ctxc.RandomSortTxOut();
+  }
+  response.hex = ctxc.GetHex();
+  return response;
+}
+
+/**
+ * @brief Create the signature hash of the txin.
+ * @param[in] txin      sighash target txin
+ * @param[in,out] tx    transaction context (utxos collected)
+ * @return signature hash hex
+ */
+static std::string CreateTxInSighash(
+    const GetSighashTxInStruct& txin, ConfidentialTransactionContext* tx) {
+  AddressType addr_type = AddressApiBase::ConvertAddressType(txin.hash_type);
+  if (addr_type == AddressType::kTaprootAddress) {
+    throw CfdException(
+        CfdError::kCfdIllegalStateError,
+        "Elements does not yet support the taproot.");
+  }
+  OutPoint outpoint(Txid(txin.txid), txin.vout);
+  SigHashType sighashtype = TransactionStructApiBase::ConvertSigHashType(
+      txin.sighash_type, txin.sighash_anyone_can_pay, txin.sighash_rangeproof,
+      false);
+
+  WitnessVersion version = WitnessVersion::kVersion0;
+  if ((addr_type == AddressType::kP2pkhAddress) ||
+      (addr_type == AddressType::kP2shAddress)) {
+    version = WitnessVersion::kVersionNone;
+  }
+  auto utxo = tx->GetTxInUtxoData(outpoint);
+  ByteData sighash;
+  if (txin.key_data.type == "pubkey") {
+    Pubkey pubkey(txin.key_data.hex);
+    sighash = tx->CreateSignatureHash(
+        outpoint, pubkey, sighashtype, utxo.amount, version);
+  } else {
+    Script redeem_script;
+    if (txin.key_data.type == "redeem_script") {
+      redeem_script = Script(txin.key_data.hex);
+    }
+    sighash = tx->CreateSignatureHash(
+        outpoint, redeem_script, sighashtype, utxo.amount, version);
+  }
+  return sighash.GetHex();
+}
+
 // -----------------------------------------------------------------------------
 // ElementsTransactionStructApiクラス
 // -----------------------------------------------------------------------------
@@ -542,10 +906,71 @@ ElementsTransactionStructApi::DecodeRawTransaction(  // NOLINT
     }
 
     // TxOut
+    const std::vector<ConfidentialTxOutReference> txout_list =
+        ctx.GetTxOutList();
+    std::vector<bool> decode_proof_targets(
+        txout_list.size(), !request.skip_proof);
+    for (const auto index : request.decode_proof_indexes) {
+      if (index >= txout_list.size()) {
+        warn(
+            CFD_LOG_SOURCE,
+            "Failed to ElementsDecodeRawTransaction. index out of range.: {}",
+            index);
+        throw CfdException(
+            CfdError::kCfdOutOfRangeError, "index is out of range.");
+      }
+      decode_proof_targets[index] = true;
+    }
+    std::vector<ByteData> range_proofs(txout_list.size());
+    std::vector<ByteData> surjection_proofs(txout_list.size());
+    uint32_t witness_size = 0;
+    for (size_t index = 0; index < txout_list.size(); ++index) {
+      range_proofs[index] = txout_list[index].GetRangeProof();
+      surjection_proofs[index] = txout_list[index].GetSurjectionProof();
+      uint32_t range_size =
+          static_cast<uint32_t>(range_proofs[index].GetDataSize());
+      uint32_t surjection_size =
+          static_cast<uint32_t>(surjection_proofs[index].GetDataSize());
+      witness_size += TxSizeEstimator::GetVarIntSize(surjection_size) +
+                      surjection_size +
+                      TxSizeEstimator::GetVarIntSize(range_size) + range_size;
+    }
+    // The output witnesses are serialized at the end of the transaction,
+    // so the proof offsets are counted back from the total size.
+    uint32_t proof_offset = ctx.GetTotalSize() - witness_size;
+
     int32_t txout_count = 0;
-    for (const ConfidentialTxOutReference& tx_out_ref : ctx.GetTxOutList()) {
+    for (const ConfidentialTxOutReference& tx_out_ref : txout_list) {
       ElementsDecodeRawTransactionTxOutStruct tx_out_res;
       const ConfidentialValue tx_out_value = tx_out_ref.GetConfidentialValue();
+      const ByteData& range_proof = range_proofs[txout_count];
+      const ByteData& surjection_proof = surjection_proofs[txout_count];
+      bool is_decode_proof = decode_proof_targets[txout_count];
+      if (!request.skip_proof) {
+        tx_out_res.ignore_items.insert("surjectionproof_offset");
+        tx_out_res.ignore_items.insert("surjectionproof_size");
+        tx_out_res.ignore_items.insert("surjectionproof_hash");
+        tx_out_res.ignore_items.insert("rangeproof_offset");
+        tx_out_res.ignore_items.insert("rangeproof_size");
+        tx_out_res.ignore_items.insert("rangeproof_hash");
+      } else {
+        if (!GetProofLocation(
+                surjection_proof, &proof_offset,
+                &tx_out_res.surjectionproof_offset,
+                &tx_out_res.surjectionproof_size,
+                &tx_out_res.surjectionproof_hash)) {
+          tx_out_res.ignore_items.insert("surjectionproof_offset");
+          tx_out_res.ignore_items.insert("surjectionproof_size");
+          tx_out_res.ignore_items.insert("surjectionproof_hash");
+        }
+        if (!GetProofLocation(
+                range_proof, &proof_offset, &tx_out_res.rangeproof_offset,
+                &tx_out_res.rangeproof_size, &tx_out_res.rangeproof_hash)) {
+          tx_out_res.ignore_items.insert("rangeproof_offset");
+          tx_out_res.ignore_items.insert("rangeproof_size");
+          tx_out_res.ignore_items.insert("rangeproof_hash");
+        }
+      }
       if (!tx_out_value.HasBlinding()) {
         tx_out_res.value = tx_out_value.GetAmount().GetSatoshiValue();
         tx_out_res.ignore_items.insert("value-minimum");
@@ -556,8 +981,7 @@ ElementsTransactionStructApi::DecodeRawTransaction(  // NOLINT
         tx_out_res.ignore_items.insert("rangeproof");
         tx_out_res.ignore_items.insert("valuecommitment");
       } else {
-        const ByteData& range_proof = tx_out_ref.GetRangeProof();
-        if (range_proof.GetDataSize()) {
+        if (range_proof.GetDataSize() && is_decode_proof) {
           const RangeProofInfo& range_proof_info =
               ConfidentialTxOut::DecodeRangeProofInfo(range_proof);
           tx_out_res.value_minimum =
@@ -575,13 +999,13 @@ ElementsTransactionStructApi::DecodeRawTransaction(  // NOLINT
           tx_out_res.ignore_items.insert("ct-bits");
         }
 
-        const ByteData& surjection_proof = tx_out_ref.GetSurjectionProof();
-        if (surjection_proof.GetDataSize()) {
+        if (surjection_proof.GetDataSize() && is_decode_proof) {
           tx_out_res.surjectionproof = surjection_proof.GetHex();
         } else {
           tx_out_res.ignore_items.insert("surjectionproof");
         }
-        if (request.full_dump) {
+        // On skipProof mode, the target outputs are fully dumped.
+        if (is_decode_proof && (request.full_dump || request.skip_proof)) {
           tx_out_res.rangeproof = range_proof.GetHex();
         } else {
           tx_out_res.ignore_items.insert("rangeproof");
@@ -1098,45 +1522,7 @@ CreateSignatureHashResponseStruct ElementsTransactionStructApi::GetSighash(
     auto utxo_list =
         TransactionStructApiBase::ConvertUtxoList(request.utxos, &factory);
     tx.CollectInputUtxo(utxo_list);
-
-    AddressType addr_type =
-        AddressApiBase::ConvertAddressType(request.txin.hash_type);
-    OutPoint outpoint(Txid(request.txin.txid), request.txin.vout);
-    bool has_taproot = (addr_type == AddressType::kTaprootAddress);
-    SigHashType sighashtype = TransactionStructApiBase::ConvertSigHashType(
-        request.txin.sighash_type, request.txin.sighash_anyone_can_pay,
-        request.txin.sighash_rangeproof, has_taproot);
-
-    Script redeem_script;
-    bool is_pubkey = false;
-    if (request.txin.key_data.type == "pubkey") {
-      is_pubkey = true;
-    } else if (request.txin.key_data.type == "redeem_script") {
-      redeem_script = Script(request.txin.key_data.hex);
-    }
-
-    if (has_taproot) {
-      throw CfdException(
-          CfdError::kCfdIllegalStateError,
-          "Elements does not yet support the taproot.");
-    } else {
-      WitnessVersion version = WitnessVersion::kVersion0;
-      if ((addr_type == AddressType::kP2pkhAddress) ||
-          (addr_type == AddressType::kP2shAddress)) {
-        version = WitnessVersion::kVersionNone;
-      }
-      auto utxo = tx.GetTxInUtxoData(outpoint);
-      ByteData sighash;
-      if (is_pubkey) {
-        Pubkey pubkey(request.txin.key_data.hex);
-        sighash = tx.CreateSignatureHash(
-            outpoint, pubkey, sighashtype, utxo.amount, version);
-      } else {
-        sighash = tx.CreateSignatureHash(
-            outpoint, redeem_script, sighashtype, utxo.amount, version);
-      }
-      response.sighash = sighash.GetHex();
-    }
+    response.sighash = CreateTxInSighash(request.txin, &tx);
     return response;
   };
 
@@ -1147,6 +1533,38 @@ CreateSignatureHashResponseStruct ElementsTransactionStructApi::GetSighash(
   return result;
 }
 
+GetSighashesResponseStruct ElementsTransactionStructApi::GetSighashes(
+    const GetSighashesRequestStruct& request) {
+  auto call_func = [](const GetSighashesRequestStruct& request)
+      -> GetSighashesResponseStruct {  // NOLINT
+    GetSighashesResponseStruct response;
+    ConfidentialTransactionContext tx(request.tx);
+    ElementsAddressFactory factory;
+    auto utxo_list =
+        TransactionStructApiBase::ConvertUtxoList(request.utxos, &factory);
+    tx.CollectInputUtxo(utxo_list);
+
+    // Each sighash is computed independently by cfd. The shared BIP143
+    // hashes (hashPrevouts etc.) are not reused across txins; only the
+    // parsed transaction and the utxo lookup are shared.
+    response.sighashes.reserve(request.txins.size());
+    for (const auto& txin : request.txins) {
+      SighashDataStruct data;
+      data.txid = txin.txid;
+      data.vout = txin.vout;
+      data.sighash = CreateTxInSighash(txin, &tx);
+      response.sighashes.push_back(data);
+    }
+    return response;
+  };
+
+  GetSighashesResponseStruct result;
+  result =
+      ExecuteStructApi<GetSighashesRequestStruct, GetSighashesResponseStruct>(
+          request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 RawTransactionResponseStruct
 ElementsTransactionStructApi::AddTaprootSchnorrSign(
     const AddTaprootSchnorrSignRequestStruct& request) {
@@ -1690,81 +2108,14 @@ SetRawIssueAssetResponseStruct ElementsTransactionStructApi::SetRawIssueAsset(
       -> SetRawIssueAssetResponseStruct {  // NOLINT
     SetRawIssueAssetResponseStruct response;
 
-    ElementsAddressFactory address_factory;
-    std::vector<TxInIssuanceParameters> issuance_param;
     std::vector<IssuanceOutput> issuance_output;
-
-    for (auto& issuance : request.issuances) {
-      ConfidentialTxOut asset_txout;
-      ConfidentialTxOut token_txout;
-      Amount asset_amount =
-          Amount::CreateBySatoshiAmount(issuance.asset_amount);
-      Amount token_amount =
-          Amount::CreateBySatoshiAmount(issuance.token_amount);
-
-      if (ElementsConfidentialAddress::IsConfidentialAddress(
-              issuance.asset_address)) {
-        ElementsConfidentialAddress confidential_addr(issuance.asset_address);
-        if (issuance.is_remove_nonce) {
-          asset_txout = ConfidentialTxOut(
-              confidential_addr.GetUnblindedAddress(), ConfidentialAssetId(),
-              asset_amount);
-        } else {
-          asset_txout = ConfidentialTxOut(
-              confidential_addr, ConfidentialAssetId(), asset_amount);
-        }
-      } else {
-        Address unblind_addr =
-            address_factory.GetAddress(issuance.asset_address);
-        asset_txout = ConfidentialTxOut(
-            unblind_addr, ConfidentialAssetId(), asset_amount);
-      }
-
-      if (ElementsConfidentialAddress::IsConfidentialAddress(
-              issuance.token_address)) {
-        ElementsConfidentialAddress confidential_addr(issuance.token_address);
-        if (issuance.is_remove_nonce) {
-          token_txout = ConfidentialTxOut(
-              confidential_addr.GetUnblindedAddress(), ConfidentialAssetId(),
-              token_amount);
-        } else {
-          token_txout = ConfidentialTxOut(
-              confidential_addr, ConfidentialAssetId(), token_amount);
-        }
-      } else {
-        Address unblind_addr =
-            address_factory.GetAddress(issuance.token_address);
-        token_txout = ConfidentialTxOut(
-            unblind_addr, ConfidentialAssetId(), token_amount);
-      }
-
-      TxInIssuanceParameters param;
-      param.txid = Txid(issuance.txid);
-      param.vout = issuance.vout;
-      param.asset_amount = asset_amount;
-      param.asset_txout = asset_txout;
-      param.token_amount = token_amount;
-      param.token_txout = token_txout;
-      if (!issuance.contract_hash.empty()) {
-        param.contract_hash = ByteData256(issuance.contract_hash);
-      }
-      param.is_blind = issuance.is_blind;
-      issuance_param.push_back(param);
-    }
-
     ElementsTransactionApi api;
-    ConfidentialTransactionController ctxc =
-        api.SetRawIssueAsset(request.tx, issuance_param, &issuance_output);
+    ConfidentialTransactionController ctxc = api.SetRawIssueAsset(
+        request.tx, CreateIssuanceParameters(request.issuances),
+        &issuance_output);
 
     for (const auto& output : issuance_output) {
-      IssuanceDataResponseStruct res_issuance;
-      res_issuance.txid = output.txid.GetHex();
-      res_issuance.vout = output.vout;
-      res_issuance.asset = output.output.asset.GetHex();
-      res_issuance.entropy = output.output.entropy.GetHex();
-      res_issuance.token = output.output.token.GetHex();
-
-      response.issuances.push_back(res_issuance);
+      response.issuances.push_back(ConvertIssuanceOutput(output, false));
     }
 
     // すべて設定後にTxoutのRandomSort
@@ -1789,53 +2140,15 @@ ElementsTransactionStructApi::SetRawReissueAsset(
   auto call_func = [](const SetRawReissueAssetRequestStruct& request)
       -> SetRawReissueAssetResponseStruct {
     SetRawReissueAssetResponseStruct response;
-    ElementsAddressFactory address_factory;
-    std::vector<TxInReissuanceParameters> reissuance_param;
-    std::vector<IssuanceOutput> reissuance_output;
-
-    for (auto& issuance : request.issuances) {
-      ConfidentialTxOut asset_txout;
-      Amount amount = Amount::CreateBySatoshiAmount(issuance.amount);
-
-      if (ElementsConfidentialAddress::IsConfidentialAddress(
-              issuance.address)) {
-        ElementsConfidentialAddress confidential_addr(issuance.address);
-        if (issuance.is_remove_nonce) {
-          asset_txout = ConfidentialTxOut(
-              confidential_addr.GetUnblindedAddress(), ConfidentialAssetId(),
-              amount);
-        } else {
-          asset_txout = ConfidentialTxOut(
-              confidential_addr, ConfidentialAssetId(), amount);
-        }
-      } else {
-        Address unblind_addr = address_factory.GetAddress(issuance.address);
-        asset_txout =
-            ConfidentialTxOut(unblind_addr, ConfidentialAssetId(), amount);
-      }
-
-      TxInReissuanceParameters param;
-      param.txid = Txid(issuance.txid);
-      param.vout = issuance.vout;
-      param.amount = amount;
-      param.asset_txout = asset_txout;
-      param.blind_factor = BlindFactor(issuance.asset_blinding_nonce);
-      param.entropy = BlindFactor(issuance.asset_entropy);
-      reissuance_param.push_back(param);
-    }
 
+    std::vector<IssuanceOutput> reissuance_output;
     ElementsTransactionApi api;
     ConfidentialTransactionController ctxc = api.SetRawReissueAsset(
-        request.tx, reissuance_param, &reissuance_output);
+        request.tx, CreateReissuanceParameters(request.issuances),
+        &reissuance_output);
 
     for (const auto& output : reissuance_output) {
-      IssuanceDataResponseStruct res_issuance;
-      res_issuance.ignore_items.insert("token");
-      res_issuance.txid = output.txid.GetHex();
-      res_issuance.vout = output.vout;
-      res_issuance.asset = output.output.asset.GetHex();
-      res_issuance.entropy = output.output.entropy.GetHex();
-      response.issuances.push_back(res_issuance);
+      response.issuances.push_back(ConvertIssuanceOutput(output, true));
     }
 
     // すべて設定後にTxoutのRandomSort
@@ -1855,101 +2168,186 @@ ElementsTransactionStructApi::SetRawReissueAsset(
   return result;
 }
 
+SetRawIssuanceBatchResponseStruct
+ElementsTransactionStructApi::SetRawIssuanceBatch(
+    const SetRawIssuanceBatchRequestStruct& request) {
+  auto call_func = [](const SetRawIssuanceBatchRequestStruct& request)
+      -> SetRawIssuanceBatchResponseStruct {  // NOLINT
+    SetRawIssuanceBatchResponseStruct response;
+    // Each transaction is independent, so they are issued concurrently.
+    response.results.resize(request.requests.size());
+    ParallelExecutor::Execute(
+        request.requests.size(), request.thread_count,
+        [&request, &response](size_t index) {
+          response.results[index] =
+              SetIssuanceByRequest(request.requests[index]);
+        });
+    return response;
+  };
+
+  SetRawIssuanceBatchResponseStruct result;
+  result = ExecuteStructApi<
+      SetRawIssuanceBatchRequestStruct, SetRawIssuanceBatchResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 RawTransactionResponseStruct
 ElementsTransactionStructApi::CreateRawPeginTransaction(  // NOLINT
     const CreateRawPeginRequestStruct& request) {
   auto call_func = [](const CreateRawPeginRequestStruct& request)
       -> RawTransactionResponseStruct {  // NOLINT
-    RawTransactionResponseStruct response;
-    // Transaction作成
-    std::vector<ConfidentialTxIn> txins;
-    std::vector<ConfidentialTxOut> txouts;
-    std::vector<TxInPeginParameters> pegins;
+    return CreatePeginTransactionByRequest(request, nullptr);
+  };
 
-    // TxInの追加
-    for (const auto& txin_req : request.txins) {
-      Txid txid(txin_req.txid);
-      txins.emplace_back(txid, txin_req.vout, txin_req.sequence);
+  RawTransactionResponseStruct result;
+  result = ExecuteStructApi<
+      CreateRawPeginRequestStruct, RawTransactionResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
 
-      // PeginWitnessの追加
-      if (txin_req.is_pegin) {
-        info(
-            CFD_LOG_SOURCE, "rm btcWitness[{}]",
-            txin_req.is_remove_mainchain_tx_witness);
-        TxInPeginParameters pegin_data;
-        pegin_data.txid = txid;
-        pegin_data.vout = txin_req.vout;
-        pegin_data.amount =
-            Amount::CreateBySatoshiAmount(txin_req.peginwitness.amount);
-        pegin_data.asset = ConfidentialAssetId(txin_req.peginwitness.asset);
-        pegin_data.mainchain_blockhash =
-            BlockHash(txin_req.peginwitness.mainchain_genesis_block_hash);
-        pegin_data.claim_script = Script(txin_req.peginwitness.claim_script);
-        pegin_data.mainchain_raw_tx =
-            ConfidentialTransaction::GetBitcoinTransaction(
-                ByteData(txin_req.peginwitness.mainchain_raw_transaction),
-                txin_req.is_remove_mainchain_tx_witness);
-        pegin_data.mainchain_txoutproof =
-            ByteData(txin_req.peginwitness.mainchain_txoutproof);
-        pegins.push_back(pegin_data);
+CreateRawPeginBatchResponseStruct
+ElementsTransactionStructApi::CreateRawPeginTransactionBatch(
+    const CreateRawPeginBatchRequestStruct& request) {
+  auto call_func = [](const CreateRawPeginBatchRequestStruct& request)
+      -> CreateRawPeginBatchResponseStruct {  // NOLINT
+    CreateRawPeginBatchResponseStruct response;
+    // Every distinct txoutproof is parsed once. Only the block header hash
+    // is shared by the txoutproofs of the same block.
+    std::map<std::string, size_t> proof_index_map;
+    std::vector<PeginTxOutProofData> proofs;
+    std::map<std::string, size_t> block_index_map;
+    std::vector<std::string> block_header_list;
+    std::map<std::string, PeginMainchainTxData> mainchain_tx_map;
+    std::vector<const ElementsPeginTxInStruct*> mainchain_txin_list;
+    for (const auto& pegin_request : request.requests) {
+      for (const auto& txin : pegin_request.txins) {
+        if (!txin.is_pegin) continue;
+        const std::string& proof = txin.peginwitness.mainchain_txoutproof;
+        if (proof_index_map.emplace(proof, proofs.size()).second) {
+          std::string header = TxOutProof::GetBlockHeaderKey(proof);
+          auto block_ite =
+              block_index_map.emplace(header, block_header_list.size());
+          if (block_ite.second) block_header_list.push_back(header);
+          PeginTxOutProofData data;
+          data.proof = proof;
+          data.block_index = block_ite.first->second;
+          proofs.push_back(data);
+        }
+        auto key = GetPeginMainchainTxKey(txin);
+        if (mainchain_tx_map.emplace(key, PeginMainchainTxData()).second) {
+          mainchain_txin_list.push_back(&txin);
+        }
       }
     }
 
-    // TxOutの追加
-    ElementsAddressFactory address_factory;
-    Script script;
-    for (const auto& txout_req : request.txouts) {
-      const std::string& addr = txout_req.address;
-      Amount amount(Amount::CreateBySatoshiAmount(txout_req.amount));
-      ConfidentialAssetId asset(txout_req.asset);
-      if (!txout_req.direct_locking_script.empty()) {
-        txouts.emplace_back(
-            Script(txout_req.direct_locking_script), asset,
-            ConfidentialValue(amount),
-            ConfidentialNonce(txout_req.direct_nonce), ByteData(), ByteData());
-      } else {
-        if (ElementsConfidentialAddress::IsConfidentialAddress(addr)) {
-          ElementsConfidentialAddress confidential_addr(addr);
-          if (txout_req.is_remove_nonce) {
-            txouts.emplace_back(
-                confidential_addr.GetUnblindedAddress(), asset, amount);
-          } else {
-            txouts.emplace_back(confidential_addr, asset, amount);
+    std::vector<BlockHash> block_hashes(block_header_list.size());
+    ParallelExecutor::Execute(
+        block_header_list.size(), request.thread_count,
+        [&block_header_list, &block_hashes](size_t index) {
+          block_hashes[index] =
+              TxOutProof::GetBlockHash(block_header_list[index]);
+        });
+    ParallelExecutor::Execute(
+        proofs.size(), request.thread_count,
+        [&proofs, &block_hashes](size_t index) {
+          PeginTxOutProofData& data = proofs[index];
+          TxOutProof proof(
+              ByteData(data.proof), block_hashes[data.block_index]);
+          for (const auto& txid : proof.GetTxids()) {
+            data.txids.insert(txid.GetHex());
           }
-        } else {
-          ConfidentialTxOut txout(
-              address_factory.GetAddress(addr), asset, amount);
-          txout.SetNonce(ConfidentialNonce(txout_req.direct_nonce));
-          txouts.emplace_back(txout);
+        });
+    std::vector<PeginMainchainTxData> mainchain_txs(
+        mainchain_txin_list.size());
+    ParallelExecutor::Execute(
+        mainchain_txin_list.size(), request.thread_count,
+        [&mainchain_txin_list, &mainchain_txs](size_t index) {
+          const ElementsPeginTxInStruct& txin = *mainchain_txin_list[index];
+          const std::string& raw_tx =
+              txin.peginwitness.mainchain_raw_transaction;
+          Transaction mainchain_tx(raw_tx);
+          PeginMainchainTxData& data = mainchain_txs[index];
+          data.tx = ConfidentialTransaction::GetBitcoinTransaction(
+              ByteData(raw_tx), txin.is_remove_mainchain_tx_witness);
+          data.txid = mainchain_tx.GetTxid();
+          uint32_t txout_count = mainchain_tx.GetTxOutCount();
+          data.amounts.reserve(txout_count);
+          for (uint32_t vout = 0; vout < txout_count; ++vout) {
+            data.amounts.push_back(
+                mainchain_tx.GetTxOut(vout).GetValue().GetSatoshiValue());
+          }
+        });
+    for (size_t index = 0; index < mainchain_txin_list.size(); ++index) {
+      mainchain_tx_map[GetPeginMainchainTxKey(*mainchain_txin_list[index])] =
+          mainchain_txs[index];
+    }
+
+    // check the claims.
+    for (const auto& pegin_request : request.requests) {
+      for (const auto& txin : pegin_request.txins) {
+        if (!txin.is_pegin) continue;
+        const PeginMainchainTxData& mainchain_tx =
+            mainchain_tx_map.at(GetPeginMainchainTxKey(txin));
+        const PeginTxOutProofData& proof = proofs[proof_index_map.at(
+            txin.peginwitness.mainchain_txoutproof)];
+        if (!mainchain_tx.txid.Equals(Txid(txin.txid))) {
+          warn(
+              CFD_LOG_SOURCE,
+              "Failed to CreateRawPeginTransactionBatch. "
+              "txid unmatch.: {}/{}",
+              txin.txid, mainchain_tx.txid.GetHex());
+          throw CfdException(
+              CfdError::kCfdIllegalArgumentError,
+              "pegin txid does not match the mainchain transaction.");
+        }
+        if (proof.txids.count(mainchain_tx.txid.GetHex()) == 0) {
+          warn(
+              CFD_LOG_SOURCE,
+              "Failed to CreateRawPeginTransactionBatch. "
+              "txid not found in txoutproof.: {}",
+              txin.txid);
+          throw CfdException(
+              CfdError::kCfdIllegalArgumentError,
+              "mainchain transaction is not in txoutproof.");
+        }
+        if (txin.vout >= mainchain_tx.amounts.size()) {
+          warn(
+              CFD_LOG_SOURCE,
+              "Failed to CreateRawPeginTransactionBatch. "
+              "vout out of range.: {}/{}",
+              txin.vout, mainchain_tx.amounts.size());
+          throw CfdException(
+              CfdError::kCfdOutOfRangeError, "pegin vout is out of range.");
+        }
+        if (mainchain_tx.amounts[txin.vout] != txin.peginwitness.amount) {
+          warn(
+              CFD_LOG_SOURCE,
+              "Failed to CreateRawPeginTransactionBatch. "
+              "amount unmatch.: {}/{}",
+              txin.peginwitness.amount, mainchain_tx.amounts[txin.vout]);
+          throw CfdException(
+              CfdError::kCfdIllegalArgumentError,
+              "pegin amount does not match the mainchain output.");
         }
       }
     }
 
-    // feeの追加
-    ConfidentialTxOut txout_fee;
-    // amountが0のfeeは無効と判定
-    if (request.fee.amount != 0) {
-      txout_fee = ConfidentialTxOut(
-          ConfidentialAssetId(request.fee.asset),
-          Amount::CreateBySatoshiAmount(request.fee.amount));
-    }
-
-    ElementsTransactionApi api;
-    ConfidentialTransactionController ctxc = api.CreateRawPeginTransaction(
-        request.version, request.locktime, txins, pegins, txouts, txout_fee);
-
-    // すべて設定後にTxoutのRandomSort
-    if (request.is_random_sort_tx_out) {
-      ctxc.RandomSortTxOut();
-    }
-
-    response.hex = ctxc.GetHex();
+    response.results.resize(request.requests.size());
+    ParallelExecutor::Execute(
+        request.requests.size(), request.thread_count,
+        [&request, &response, &mainchain_tx_map](size_t index) {
+          response.results[index] = CreatePeginTransactionByRequest(
+              request.requests[index], &mainchain_tx_map);
+        });
+    response.verified_proof_count = static_cast<uint32_t>(proofs.size());
     return response;
   };
 
-  RawTransactionResponseStruct result;
+  CreateRawPeginBatchResponseStruct result;
   result = ExecuteStructApi<
-      CreateRawPeginRequestStruct, RawTransactionResponseStruct>(
+      CreateRawPeginBatchRequestStruct, CreateRawPeginBatchResponseStruct>(
       request, call_func, std::string(__FUNCTION__));
   return result;
 }
@@ -2145,6 +2543,30 @@ BlindingKeyResponseStruct ElementsTransactionStructApi::GetDefaultBlindingKey(
   return result;
 }
 
+GetDefaultBlindingKeyBatchResponseStruct
+ElementsTransactionStructApi::GetDefaultBlindingKeyBatch(
+    const GetDefaultBlindingKeyBatchRequestStruct& request) {
+  auto call_func = [](const GetDefaultBlindingKeyBatchRequestStruct& request)
+      -> GetDefaultBlindingKeyBatchResponseStruct {  // NOLINT
+    GetDefaultBlindingKeyBatchResponseStruct response;
+    Slip77KeyDeriver deriver(
+        Privkey(request.master_blinding_key), request.use_cache);
+    response.blinding_keys.reserve(request.locking_scripts.size());
+    for (const auto& locking_script : request.locking_scripts) {
+      response.blinding_keys.push_back(
+          deriver.GetBlindingKey(Script(locking_script)).GetHex());
+    }
+    return response;
+  };
+
+  GetDefaultBlindingKeyBatchResponseStruct result;
+  result = ExecuteStructApi<
+      GetDefaultBlindingKeyBatchRequestStruct,
+      GetDefaultBlindingKeyBatchResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 RawTransactionResponseStruct
 ElementsTransactionStructApi::CreateDestroyAmountTransaction(
     const CreateDestroyAmountRequestStruct& request) {
@@ -2266,9 +2688,10 @@ GetCommitmentResponseStruct ElementsTransactionStructApi::GetCommitment(
       -> GetCommitmentResponseStruct {  // NOLINT
     GetCommitmentResponseStruct response;
 
-    ConfidentialAssetId asset_commitment = ConfidentialAssetId::GetCommitment(
-        ConfidentialAssetId(request.asset),
-        BlindFactor(request.asset_blind_factor));
+    ConfidentialAssetId asset_commitment =
+        ConfidentialAssetId::GetCommitment(
+            ConfidentialAssetId(request.asset),
+            BlindFactor(request.asset_blind_factor));
     ConfidentialValue amount_commitment = ConfidentialValue::GetCommitment(
         Amount(request.amount), asset_commitment,
         BlindFactor(request.blind_factor));
@@ -2285,6 +2708,79 @@ GetCommitmentResponseStruct ElementsTransactionStructApi::GetCommitment(
   return result;
 }
 
+GetCommitmentsResponseStruct ElementsTransactionStructApi::GetCommitments(
+    const GetCommitmentsRequestStruct& request) {
+  auto call_func = [](const GetCommitmentsRequestStruct& request)
+      -> GetCommitmentsResponseStruct {  // NOLINT
+    GetCommitmentsResponseStruct response;
+    response.commitments.reserve(request.targets.size());
+    for (const auto& target : request.targets) {
+      ConfidentialAssetId asset_commitment = ConfidentialAssetId::GetCommitment(
+          ConfidentialAssetId(target.asset),
+          BlindFactor(target.asset_blind_factor));
+      ConfidentialValue amount_commitment = ConfidentialValue::GetCommitment(
+          Amount(target.amount), asset_commitment,
+          BlindFactor(target.blind_factor));
+
+      CommitmentDataStruct data;
+      data.asset_commitment = asset_commitment.GetHex();
+      data.amount_commitment = amount_commitment.GetHex();
+      response.commitments.push_back(data);
+    }
+    return response;
+  };
+
+  GetCommitmentsResponseStruct result;
+  result = ExecuteStructApi<
+      GetCommitmentsRequestStruct, GetCommitmentsResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
+EstimateBlindProofSizeResponseStruct
+ElementsTransactionStructApi::EstimateBlindProofSize(
+    const EstimateBlindProofSizeRequestStruct& request) {
+  auto call_func = [](const EstimateBlindProofSizeRequestStruct& request)
+      -> EstimateBlindProofSizeResponseStruct {  // NOLINT
+    static constexpr uint32_t kMaxSurjectionInputCount = 256;
+    EstimateBlindProofSizeResponseStruct response;
+    response.txs.reserve(request.txs.size());
+    for (const auto& tx : request.txs) {
+      if ((tx.surjection_input_count == 0) ||
+          (tx.surjection_input_count > kMaxSurjectionInputCount)) {
+        warn(
+            CFD_LOG_SOURCE,
+            "Failed to EstimateBlindProofSize. surjectionInputCount={}",
+            tx.surjection_input_count);
+        throw CfdException(
+            CfdError::kCfdIllegalArgumentError,
+            "Invalid surjectionInputCount.");
+      }
+
+      EstimateBlindProofSizeDataStruct data;
+      data.surjection_proof_size =
+          TxSizeEstimator::GetSurjectionProofSize(tx.surjection_input_count);
+      data.rangeproof_sizes.reserve(tx.amounts.size());
+      for (const auto& amount : tx.amounts) {
+        uint32_t rangeproof_size = TxSizeEstimator::GetRangeProofSize(
+            amount, request.exponent, request.minimum_bits);
+        data.rangeproof_sizes.push_back(rangeproof_size);
+        data.blind_weight += TxSizeEstimator::GetBlindTxOutWeight(
+            rangeproof_size, data.surjection_proof_size);
+      }
+      response.txs.push_back(data);
+    }
+    return response;
+  };
+
+  EstimateBlindProofSizeResponseStruct result;
+  result = ExecuteStructApi<
+      EstimateBlindProofSizeRequestStruct,
+      EstimateBlindProofSizeResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 UnblindOutputStruct ElementsTransactionStructApi::GetUnblindData(
     const GetUnblindDataRequestStruct& request) {
   auto call_func = [](const GetUnblindDataRequestStruct& request)
@@ -2316,6 +2812,148 @@ UnblindOutputStruct ElementsTransactionStructApi::GetUnblindData(
   return result;
 }
 
+ScanAndUnblindResponseStruct ElementsTransactionStructApi::ScanAndUnblind(
+    const ScanAndUnblindRequestStruct& request) {
+  auto call_func = [](const ScanAndUnblindRequestStruct& request)
+      -> ScanAndUnblindResponseStruct {  // NOLINT
+    ScanAndUnblindResponseStruct response;
+    std::unique_ptr<Slip77KeyDeriver> deriver;
+    if (!request.master_blinding_key.empty()) {
+      deriver.reset(new Slip77KeyDeriver(
+          Privkey::HasWif(request.master_blinding_key)
+              ? Privkey::FromWif(request.master_blinding_key)
+              : Privkey(request.master_blinding_key)));
+    }
+
+    // locking script hex -> blinding key
+    std::map<std::string, Privkey> key_map;
+    ElementsAddressFactory address_factory;
+    for (const auto& script_data : request.scripts) {
+      Script locking_script;
+      if (!script_data.locking_script.empty()) {
+        locking_script = Script(script_data.locking_script);
+      } else if (script_data.address.empty()) {
+        warn(
+            CFD_LOG_SOURCE,
+            "Failed to ScanAndUnblind. address and lockingScript are empty.");
+        throw CfdException(
+            CfdError::kCfdIllegalArgumentError,
+            "Failed to ScanAndUnblind. address or lockingScript is required.");
+      } else if (ElementsConfidentialAddress::IsConfidentialAddress(
+                     script_data.address)) {
+        ElementsConfidentialAddress confidential_addr(script_data.address);
+        locking_script =
+            confidential_addr.GetUnblindedAddress().GetLockingScript();
+      } else {
+        locking_script =
+            address_factory.GetAddress(script_data.address).GetLockingScript();
+      }
+
+      Privkey blinding_key;
+      if (!script_data.blinding_key.empty()) {
+        blinding_key = Privkey::HasWif(script_data.blinding_key)
+                           ? Privkey::FromWif(script_data.blinding_key)
+                           : Privkey(script_data.blinding_key);
+      } else if (deriver) {
+        blinding_key = deriver->GetBlindingKey(locking_script);
+      } else {
+        warn(
+            CFD_LOG_SOURCE,
+            "Failed to ScanAndUnblind. blinding key is empty.: script={}",
+            locking_script.GetHex());
+        throw CfdException(
+            CfdError::kCfdIllegalArgumentError,
+            "Failed to ScanAndUnblind. "
+            "blindingKey or masterBlindingKey is required.");
+      }
+      key_map[locking_script.GetHex()] = blinding_key;
+    }
+
+    // Only the outputs of the wallet scripts are collected, so the
+    // rangeproofs of the other outputs are never rewound.
+    std::vector<std::vector<ScanUnblindTarget>> targets_list(
+        request.txs.size());
+    ParallelExecutor::Execute(
+        request.txs.size(), request.thread_count,
+        [&request, &key_map, &targets_list](size_t index) {
+          ConfidentialTransaction tx(request.txs[index]);
+          std::vector<ScanUnblindTarget>& targets = targets_list[index];
+          uint32_t vout = 0;
+          for (const auto& txout : tx.GetTxOutList()) {
+            auto ite = key_map.find(txout.GetLockingScript().GetHex());
+            if (ite != key_map.end()) {
+              ScanUnblindTarget target;
+              target.vout = vout;
+              target.locking_script = txout.GetLockingScript();
+              target.asset = txout.GetAsset();
+              target.value = txout.GetConfidentialValue();
+              target.nonce = txout.GetNonce();
+              target.range_proof = txout.GetRangeProof();
+              target.blinding_key = ite->second;
+              targets.push_back(target);
+            }
+            ++vout;
+          }
+          if (!targets.empty()) {
+            Txid txid = tx.GetTxid();
+            for (auto& target : targets) target.txid = txid;
+          }
+        });
+
+    std::vector<ScanUnblindTarget> targets;
+    for (const auto& tx_targets : targets_list) {
+      targets.insert(targets.end(), tx_targets.begin(), tx_targets.end());
+    }
+
+    std::vector<ScanUnblindOutputStruct> outputs(targets.size());
+    std::vector<uint8_t> is_unblinded(targets.size(), 0);
+    ParallelExecutor::Execute(
+        targets.size(), request.thread_count,
+        [&targets, &outputs, &is_unblinded](size_t index) {
+          const ScanUnblindTarget& target = targets[index];
+          ScanUnblindOutputStruct& output = outputs[index];
+          output.txid = target.txid.GetHex();
+          output.index = target.vout;
+          output.locking_script = target.locking_script.GetHex();
+          if (!target.value.HasBlinding()) {
+            output.asset = target.asset.GetHex();
+            output.amount = target.value.GetAmount().GetSatoshiValue();
+            output.blind_factor = BlindFactor().GetHex();
+            output.asset_blind_factor = BlindFactor().GetHex();
+            is_unblinded[index] = 1;
+            return;
+          }
+          try {
+            ConfidentialTxOut txout(
+                target.locking_script, target.asset, target.value,
+                target.nonce, ByteData(), target.range_proof);
+            auto unblind_data = txout.Unblind(target.blinding_key);
+            output.asset = unblind_data.asset.GetHex();
+            output.amount = unblind_data.value.GetAmount().GetSatoshiValue();
+            output.blind_factor = unblind_data.vbf.GetHex();
+            output.asset_blind_factor = unblind_data.abf.GetHex();
+            is_unblinded[index] = 1;
+          } catch (const CfdException& except) {
+            // blinded to another key. (reused script)
+            info(
+                CFD_LOG_SOURCE, "ScanAndUnblind skip output.: {},{} {}",
+                output.txid, target.vout, except.what());
+          }
+        });
+
+    for (size_t index = 0; index < outputs.size(); ++index) {
+      if (is_unblinded[index] != 0) response.outputs.push_back(outputs[index]);
+    }
+    return response;
+  };
+
+  ScanAndUnblindResponseStruct result;
+  result = ExecuteStructApi<
+      ScanAndUnblindRequestStruct, ScanAndUnblindResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 namespace json {
 
 // -----------------------------------------------------------------------------
@@ -2424,6 +3062,17 @@ void ElementsTransactionJsonApi::FundRawTransaction(
     select_utxos.push_back(data);
   }
 
+  // The pool stays locked while the transaction is funded.
+  std::shared_ptr<UtxoPool> pool;
+  std::unique_lock<std::mutex> pool_lock;
+  const std::vector<UtxoData>* utxo_list = &utxos;
+  if (request->GetUtxoPoolId() != 0) {
+    pool = UtxoPoolManager::GetInstance().GetPool(
+        request->GetUtxoPoolId(), true, !utxos.empty());
+    pool_lock = pool->GetLock();
+    utxo_list = &pool->GetUtxoDataList();
+  }
+
   // in parameter
   const FundFeeInformation& fee_info = request->GetFeeInfo();
   CoinSelectionOption option;
@@ -2460,7 +3109,7 @@ void ElementsTransactionJsonApi::FundRawTransaction(
   std::vector<std::string> append_txout_addresses;
   ElementsTransactionApi api;
   ConfidentialTransactionController ctxc = api.FundRawTransaction(
-      request->GetTx(), utxos, target_amount_map, select_utxos,
+      request->GetTx(), *utxo_list, target_amount_map, select_utxos,
       reserve_address_map, fee_asset, fee_info.GetIsBlindEstimateFee(),
       fee_info.GetFeeRate(), &fee, nullptr, &option, &append_txout_addresses,
       net_type);
@@ -14,6 +14,7 @@
 #include "cfdapi_select_utxos_wrapper_json.h"  // NOLINT
 #include "cfdjs/cfdjs_api_address.h"
 #include "cfdjs/cfdjs_api_block.h"
+#include "cfdjs/cfdjs_api_coin.h"
 #include "cfdjs/cfdjs_api_common.h"
 #include "cfdjs/cfdjs_api_elements_address.h"
 #include "cfdjs/cfdjs_api_elements_block.h"
@@ -334,6 +335,13 @@ std::string JsonMappingApi::DecodeRawTransaction(
       request_message, TransactionStructApi::DecodeRawTransaction);
 }
 
+std::string JsonMappingApi::GetLockingScriptCacheInfo() {
+  return ExecuteJsonResponseOnlyApi<
+      api::json::GetLockingScriptCacheInfoResponse,
+      api::GetLockingScriptCacheInfoResponseStruct>(
+      TransactionStructApi::GetLockingScriptCacheInfo);
+}
+
 std::string JsonMappingApi::ConvertEntropyToMnemonic(
     const std::string &request_message) {
   return ExecuteJsonApi<
@@ -465,6 +473,18 @@ std::string JsonMappingApi::GetSighash(const std::string &request_message) {
 #endif
 }
 
+std::string JsonMappingApi::GetSighashes(const std::string &request_message) {
+  return ExecuteElementsCheckApi<
+      api::json::GetSighashesRequest, api::json::GetSighashesResponse,
+      api::GetSighashesRequestStruct, api::GetSighashesResponseStruct>(
+      request_message, TransactionStructApi::GetSighashes,
+#ifndef CFD_DISABLE_ELEMENTS
+      ElementsTransactionStructApi::GetSighashes);
+#else
+      TransactionStructApi::GetSighashes);
+#endif
+}
+
 std::string JsonMappingApi::ConvertAes(const std::string &request_message) {
   return ExecuteJsonApi<
       api::json::ConvertAesRequest, api::json::ConvertAesResponse,
@@ -912,12 +932,36 @@ std::string JsonMappingApi::EstimateFee(const std::string &request_message) {
 #endif
 }
 
+std::string JsonMappingApi::EstimateTransactionSize(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::EstimateTransactionSizeRequest,
+      api::json::EstimateTransactionSizeResponse,
+      api::EstimateTransactionSizeRequestStruct,
+      api::EstimateTransactionSizeResponseStruct>(
+      request_message, TransactionStructApi::EstimateTransactionSize);
+}
+
 std::string JsonMappingApi::SelectUtxos(const std::string &request_message) {
   return ExecuteDirectJsonApi<
       api::json::SelectUtxosWrapRequest, api::json::SelectUtxosWrapResponse>(
       request_message, CoinJsonApi::SelectUtxos);
 }
 
+std::string JsonMappingApi::SelectUtxosBatch(
+    const std::string &request_message) {
+  return ExecuteDirectJsonApi<
+      api::json::SelectUtxosBatchRequest,
+      api::json::SelectUtxosBatchResponse>(
+      request_message, CoinJsonApi::SelectUtxosBatch);
+}
+
+std::string JsonMappingApi::ReselectUtxos(const std::string &request_message) {
+  return ExecuteDirectJsonApi<
+      api::json::ReselectUtxosRequest, api::json::ReselectUtxosResponse>(
+      request_message, CoinJsonApi::ReselectUtxos);
+}
+
 std::string JsonMappingApi::FundRawTransaction(
     const std::string &request_message) {
   return ExecuteElementsCheckDirectApi<
@@ -931,6 +975,44 @@ std::string JsonMappingApi::FundRawTransaction(
 #endif
 }
 
+std::string JsonMappingApi::CreateUtxoPool(const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::CreateUtxoPoolRequest, api::json::UtxoPoolInfoResponse,
+      api::CreateUtxoPoolRequestStruct, api::UtxoPoolInfoResponseStruct>(
+      request_message, CoinStructApi::CreateUtxoPool);
+}
+
+std::string JsonMappingApi::AddUtxoPoolItems(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::AddUtxoPoolItemsRequest, api::json::UtxoPoolInfoResponse,
+      api::AddUtxoPoolItemsRequestStruct, api::UtxoPoolInfoResponseStruct>(
+      request_message, CoinStructApi::AddUtxoPoolItems);
+}
+
+std::string JsonMappingApi::RemoveUtxoPoolItems(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::RemoveUtxoPoolItemsRequest, api::json::UtxoPoolInfoResponse,
+      api::RemoveUtxoPoolItemsRequestStruct, api::UtxoPoolInfoResponseStruct>(
+      request_message, CoinStructApi::RemoveUtxoPoolItems);
+}
+
+std::string JsonMappingApi::LockUtxoPoolItems(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::LockUtxoPoolItemsRequest, api::json::UtxoPoolInfoResponse,
+      api::LockUtxoPoolItemsRequestStruct, api::UtxoPoolInfoResponseStruct>(
+      request_message, CoinStructApi::LockUtxoPoolItems);
+}
+
+std::string JsonMappingApi::DeleteUtxoPool(const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::DeleteUtxoPoolRequest, api::json::UtxoPoolInfoResponse,
+      api::DeleteUtxoPoolRequestStruct, api::UtxoPoolInfoResponseStruct>(
+      request_message, CoinStructApi::DeleteUtxoPool);
+}
+
 std::string JsonMappingApi::UpdateTxOutAmount(
     const std::string &request_message) {
   return ExecuteElementsCheckApi<
@@ -956,6 +1038,14 @@ std::string JsonMappingApi::SplitTxOut(const std::string &request_message) {
 #endif
 }
 
+std::string JsonMappingApi::EditRawTransaction(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::EditRawTransactionRequest, api::json::RawTransactionResponse,
+      api::EditRawTransactionRequestStruct, api::RawTransactionResponseStruct>(
+      request_message, TransactionStructApi::EditRawTransaction);
+}
+
 std::string JsonMappingApi::GetTxInIndex(const std::string &request_message) {
   return ExecuteElementsCheckApi<
       api::json::GetTxInIndexRequest, api::json::GetIndexData,
@@ -1362,6 +1452,16 @@ std::string JsonMappingApi::SetRawReissueAsset(
       request_message, ElementsTransactionStructApi::SetRawReissueAsset);
 }
 
+std::string JsonMappingApi::SetRawIssuanceBatch(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::SetRawIssuanceBatchRequest,
+      api::json::SetRawIssuanceBatchResponse,
+      api::SetRawIssuanceBatchRequestStruct,
+      api::SetRawIssuanceBatchResponseStruct>(
+      request_message, ElementsTransactionStructApi::SetRawIssuanceBatch);
+}
+
 std::string JsonMappingApi::CreateElementsSignatureHash(
     const std::string &request_message) {
   return ExecuteJsonApi<
@@ -1381,6 +1481,17 @@ std::string JsonMappingApi::CreateRawPegin(
       ElementsTransactionStructApi::CreateRawPeginTransaction);
 }
 
+std::string JsonMappingApi::CreateRawPeginBatch(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::CreateRawPeginBatchRequest,
+      api::json::CreateRawPeginBatchResponse,
+      api::CreateRawPeginBatchRequestStruct,
+      api::CreateRawPeginBatchResponseStruct>(
+      request_message,
+      ElementsTransactionStructApi::CreateRawPeginTransactionBatch);
+}
+
 std::string JsonMappingApi::UpdatePeginWitnessStack(
     const std::string &request_message) {
   return ExecuteJsonApi<
@@ -1415,6 +1526,17 @@ std::string JsonMappingApi::GetDefaultBlindingKey(
       request_message, ElementsTransactionStructApi::GetDefaultBlindingKey);
 }
 
+std::string JsonMappingApi::GetDefaultBlindingKeyBatch(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::GetDefaultBlindingKeyBatchRequest,
+      api::json::GetDefaultBlindingKeyBatchResponse,
+      api::GetDefaultBlindingKeyBatchRequestStruct,
+      api::GetDefaultBlindingKeyBatchResponseStruct>(
+      request_message,
+      ElementsTransactionStructApi::GetDefaultBlindingKeyBatch);  // NOLINT
+}
+
 std::string JsonMappingApi::CreateDestroyAmount(
     const std::string &request_message) {
   return ExecuteJsonApi<
@@ -1442,6 +1564,23 @@ std::string JsonMappingApi::GetCommitment(const std::string &request_message) {
       request_message, ElementsTransactionStructApi::GetCommitment);
 }
 
+std::string JsonMappingApi::GetCommitments(const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::GetCommitmentsRequest, api::json::GetCommitmentsResponse,
+      api::GetCommitmentsRequestStruct, api::GetCommitmentsResponseStruct>(
+      request_message, ElementsTransactionStructApi::GetCommitments);
+}
+
+std::string JsonMappingApi::EstimateBlindProofSize(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::EstimateBlindProofSizeRequest,
+      api::json::EstimateBlindProofSizeResponse,
+      api::EstimateBlindProofSizeRequestStruct,
+      api::EstimateBlindProofSizeResponseStruct>(
+      request_message, ElementsTransactionStructApi::EstimateBlindProofSize);
+}
+
 std::string JsonMappingApi::GetUnblindData(
     const std::string &request_message) {
   return ExecuteJsonApi<
@@ -1450,6 +1589,14 @@ std::string JsonMappingApi::GetUnblindData(
       request_message, ElementsTransactionStructApi::GetUnblindData);
 }
 
+std::string JsonMappingApi::ScanAndUnblind(
+    const std::string &request_message) {
+  return ExecuteJsonApi<
+      api::json::ScanAndUnblindRequest, api::json::ScanAndUnblindResponse,
+      api::ScanAndUnblindRequestStruct, api::ScanAndUnblindResponseStruct>(
+      request_message, ElementsTransactionStructApi::ScanAndUnblind);
+}
+
 #endif  // CFD_DISABLE_ELEMENTS
 
 void JsonMappingApi::LoadFunctions(
@@ -1458,6 +1605,9 @@ void JsonMappingApi::LoadFunctions(
   if (response_only_map != nullptr) {
     response_only_map->emplace(
         "GetSupportedFunction", JsonMappingApi::GetSupportedFunction);
+    response_only_map->emplace(
+        "GetLockingScriptCacheInfo",
+        JsonMappingApi::GetLockingScriptCacheInfo);
   }
 
   if (request_map != nullptr) {
@@ -1483,6 +1633,7 @@ void JsonMappingApi::LoadFunctions(
     request_map->emplace(
         "CreateSignatureHash", JsonMappingApi::CreateSignatureHash);
     request_map->emplace("GetSighash", JsonMappingApi::GetSighash);
+    request_map->emplace("GetSighashes", JsonMappingApi::GetSighashes);
     request_map->emplace("ConvertAes", JsonMappingApi::ConvertAes);
     request_map->emplace("EncodeBase58", JsonMappingApi::EncodeBase58);
     request_map->emplace("DecodeBase58", JsonMappingApi::DecodeBase58);
@@ -1554,12 +1705,25 @@ void JsonMappingApi::LoadFunctions(
     request_map->emplace(
         "CalculateEcSignature", JsonMappingApi::CalculateEcSignature);
     request_map->emplace("EstimateFee", JsonMappingApi::EstimateFee);
+    request_map->emplace(
+        "EstimateTransactionSize", JsonMappingApi::EstimateTransactionSize);
     request_map->emplace("SelectUtxos", JsonMappingApi::SelectUtxos);
+    request_map->emplace("SelectUtxosBatch", JsonMappingApi::SelectUtxosBatch);
+    request_map->emplace("ReselectUtxos", JsonMappingApi::ReselectUtxos);
     request_map->emplace(
         "FundRawTransaction", JsonMappingApi::FundRawTransaction);
+    request_map->emplace("CreateUtxoPool", JsonMappingApi::CreateUtxoPool);
+    request_map->emplace("AddUtxoPoolItems", JsonMappingApi::AddUtxoPoolItems);
+    request_map->emplace(
+        "RemoveUtxoPoolItems", JsonMappingApi::RemoveUtxoPoolItems);
+    request_map->emplace(
+        "LockUtxoPoolItems", JsonMappingApi::LockUtxoPoolItems);
+    request_map->emplace("DeleteUtxoPool", JsonMappingApi::DeleteUtxoPool);
     request_map->emplace(
         "UpdateTxOutAmount", JsonMappingApi::UpdateTxOutAmount);
     request_map->emplace("SplitTxOut", JsonMappingApi::SplitTxOut);
+    request_map->emplace(
+        "EditRawTransaction", JsonMappingApi::EditRawTransaction);
     request_map->emplace("GetTxInIndex", JsonMappingApi::GetTxInIndex);
     request_map->emplace("GetTxOutIndex", JsonMappingApi::GetTxOutIndex);
     request_map->emplace(
@@ -1645,10 +1809,14 @@ void JsonMappingApi::LoadFunctions(
     request_map->emplace("SetRawIssueAsset", JsonMappingApi::SetRawIssueAsset);
     request_map->emplace(
         "SetRawReissueAsset", JsonMappingApi::SetRawReissueAsset);
+    request_map->emplace(
+        "SetRawIssuanceBatch", JsonMappingApi::SetRawIssuanceBatch);
     request_map->emplace(
         "CreateElementsSignatureHash",
         JsonMappingApi::CreateElementsSignatureHash);
     request_map->emplace("CreateRawPegin", JsonMappingApi::CreateRawPegin);
+    request_map->emplace(
+        "CreateRawPeginBatch", JsonMappingApi::CreateRawPeginBatch);
     request_map->emplace(
         "UpdatePeginWitnessStack", JsonMappingApi::UpdatePeginWitnessStack);
     request_map->emplace("CreateRawPegout", JsonMappingApi::CreateRawPegout);
@@ -1656,12 +1824,19 @@ void JsonMappingApi::LoadFunctions(
         "GetIssuanceBlindingKey", JsonMappingApi::GetIssuanceBlindingKey);
     request_map->emplace(
         "GetDefaultBlindingKey", JsonMappingApi::GetDefaultBlindingKey);
+    request_map->emplace(
+        "GetDefaultBlindingKeyBatch",
+        JsonMappingApi::GetDefaultBlindingKeyBatch);
     request_map->emplace(
         "CreateDestroyAmount", JsonMappingApi::CreateDestroyAmount);
     request_map->emplace(
         "SerializeLedgerFormat", JsonMappingApi::SerializeLedgerFormat);
     request_map->emplace("GetCommitment", JsonMappingApi::GetCommitment);
+    request_map->emplace("GetCommitments", JsonMappingApi::GetCommitments);
+    request_map->emplace(
+        "EstimateBlindProofSize", JsonMappingApi::EstimateBlindProofSize);
     request_map->emplace("GetUnblindData", JsonMappingApi::GetUnblindData);
+    request_map->emplace("ScanAndUnblind", JsonMappingApi::ScanAndUnblind);
 #endif  // CFD_DISABLE_ELEMENTS
   }
 }
@@ -0,0 +1,144 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_locking_script_cache.cpp
+ *
+ * @brief Implementation of the locking script resolution cache.
+ */
+#include "cfdjs_locking_script_cache.h"  // NOLINT
+
+#include <string>
+#include <utility>
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::core::ByteData;
+
+constexpr size_t LockingScriptCache::kDefaultCapacity;
+
+//! key type of the extract data. (not used by NetType)
+static constexpr uint8_t kExtractDataKeyType = 0xff;
+
+LockingScriptCache& LockingScriptCache::GetInstance() {
+  static LockingScriptCache instance;
+  return instance;
+}
+
+LockingScriptCache::LockingScriptCache(size_t capacity)
+    : capacity_(capacity), hit_count_(0), miss_count_(0) {
+  // do nothing
+}
+
+bool LockingScriptCache::Find(
+    NetType net_type, const Script& script, LockingScriptCacheData* data) {
+  return FindEntry(CreateKey(static_cast<uint8_t>(net_type), script), data);
+}
+
+void LockingScriptCache::Store(
+    NetType net_type, const Script& script,
+    const LockingScriptCacheData& data) {
+  StoreEntry(CreateKey(static_cast<uint8_t>(net_type), script), data);
+}
+
+bool LockingScriptCache::FindExtractData(
+    const Script& script, ExtractScriptData* data) {
+  LockingScriptCacheData cache_data;
+  if (!FindEntry(CreateKey(kExtractDataKeyType, script), &cache_data)) {
+    return false;
+  }
+  if (data != nullptr) *data = cache_data.extract_data;
+  return true;
+}
+
+void LockingScriptCache::StoreExtractData(
+    const Script& script, const ExtractScriptData& data) {
+  LockingScriptCacheData cache_data;
+  cache_data.extract_data = data;
+  StoreEntry(CreateKey(kExtractDataKeyType, script), cache_data);
+}
+
+bool LockingScriptCache::FindEntry(
+    const std::string& key, LockingScriptCacheData* data) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto ite = entry_map_.find(key);
+  if (ite == entry_map_.end()) {
+    ++miss_count_;
+    return false;
+  }
+  ++hit_count_;
+  entries_.splice(entries_.begin(), entries_, ite->second);
+  if (data != nullptr) *data = ite->second->second;
+  return true;
+}
+
+void LockingScriptCache::StoreEntry(
+    std::string key, const LockingScriptCacheData& data) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (capacity_ == 0) return;
+  auto ite = entry_map_.find(key);
+  if (ite != entry_map_.end()) {
+    ite->second->second = data;
+    entries_.splice(entries_.begin(), entries_, ite->second);
+    return;
+  }
+  entries_.emplace_front(key, data);
+  entry_map_.emplace(std::move(key), entries_.begin());
+  Shrink();
+}
+
+void LockingScriptCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entry_map_.clear();
+  entries_.clear();
+  hit_count_ = 0;
+  miss_count_ = 0;
+}
+
+void LockingScriptCache::SetCapacity(size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  Shrink();
+}
+
+size_t LockingScriptCache::GetCapacity() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return capacity_;
+}
+
+size_t LockingScriptCache::GetSize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+uint64_t LockingScriptCache::GetHitCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hit_count_;
+}
+
+uint64_t LockingScriptCache::GetMissCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return miss_count_;
+}
+
+std::string LockingScriptCache::CreateKey(
+    uint8_t key_type, const Script& script) {
+  const ByteData& data = script.GetData();
+  std::string key;
+  key.reserve(data.GetDataSize() + 1);
+  key.push_back(static_cast<char>(key_type));
+  const auto& bytes = data.GetBytes();
+  key.append(bytes.begin(), bytes.end());
+  return key;
+}
+
+void LockingScriptCache::Shrink() {
+  while (entries_.size() > capacity_) {
+    entry_map_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
@@ -0,0 +1,182 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_locking_script_cache.h
+ *
+ * @brief Definition of the locking script resolution cache.
+ */
+#ifndef CFD_JS_SRC_CFDJS_LOCKING_SCRIPT_CACHE_H_
+#define CFD_JS_SRC_CFDJS_LOCKING_SCRIPT_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <mutex>  // NOLINT
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cfdcore/cfdcore_address.h"
+#include "cfdcore/cfdcore_script.h"
+#include "cfdjs_transaction_base.h"  // NOLINT
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::core::Address;
+using cfd::core::NetType;
+using cfd::core::Script;
+
+/**
+ * @brief Resolved data of a locking script.
+ */
+struct LockingScriptCacheData {
+  std::string script_type;         //!< script type string
+  int64_t require_num = 0;         //!< multisig require num (or push count)
+  std::vector<Address> addresses;  //!< address list
+  ExtractScriptData extract_data;  //!< extract data (network independent)
+};
+
+/**
+ * @brief Bounded LRU cache of locking script resolution.
+ * @details Keyed by script bytes and network. The extract data of a script
+ *     does not depend on the network, so it is stored under its own key.
+ *     All methods are thread-safe.
+ */
+class LockingScriptCache {
+ public:
+  //! default max entry count
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  /**
+   * @brief Get the process-wide cache instance.
+   * @return cache instance
+   */
+  static LockingScriptCache& GetInstance();
+
+  /**
+   * @brief constructor.
+   * @param[in] capacity    max entry count
+   */
+  explicit LockingScriptCache(size_t capacity = kDefaultCapacity);
+
+  /**
+   * @brief Find cached data. A hit moves the entry to the front.
+   * @param[in] net_type    network type
+   * @param[in] script      locking script
+   * @param[out] data       cached data
+   * @retval true   hit
+   * @retval false  miss
+   */
+  bool Find(
+      NetType net_type, const Script& script, LockingScriptCacheData* data);
+
+  /**
+   * @brief Store data. The least recently used entry is evicted when full.
+   * @param[in] net_type    network type
+   * @param[in] script      locking script
+   * @param[in] data        resolved data
+   */
+  void Store(
+      NetType net_type, const Script& script,
+      const LockingScriptCacheData& data);
+
+  /**
+   * @brief Find the cached extract data. A hit moves the entry to the front.
+   * @param[in] script      locking script
+   * @param[out] data       cached extract data
+   * @retval true   hit
+   * @retval false  miss
+   */
+  bool FindExtractData(const Script& script, ExtractScriptData* data);
+
+  /**
+   * @brief Store the extract data. The least recently used entry is evicted
+   *     when full.
+   * @param[in] script      locking script
+   * @param[in] data        extract data
+   */
+  void StoreExtractData(const Script& script, const ExtractScriptData& data);
+
+  /**
+   * @brief Clear all entries and counters.
+   */
+  void Clear();
+
+  /**
+   * @brief Change the max entry count.
+   * @param[in] capacity    max entry count (0 disables caching)
+   */
+  void SetCapacity(size_t capacity);
+
+  /**
+   * @brief Get the max entry count.
+   * @return max entry count
+   */
+  size_t GetCapacity() const;
+
+  /**
+   * @brief Get the current entry count.
+   * @return entry count
+   */
+  size_t GetSize() const;
+
+  /**
+   * @brief Get the hit count.
+   * @return hit count
+   */
+  uint64_t GetHitCount() const;
+
+  /**
+   * @brief Get the miss count.
+   * @return miss count
+   */
+  uint64_t GetMissCount() const;
+
+ private:
+  //! entry list type (front is the most recently used)
+  using EntryList = std::list<std::pair<std::string, LockingScriptCacheData>>;
+
+  /**
+   * @brief Create a cache key.
+   * @param[in] key_type    key type (network type or extract data)
+   * @param[in] script      locking script
+   * @return cache key
+   */
+  static std::string CreateKey(uint8_t key_type, const Script& script);
+
+  /**
+   * @brief Find an entry.
+   * @param[in] key     cache key
+   * @param[out] data   cached data
+   * @retval true   hit
+   * @retval false  miss
+   */
+  bool FindEntry(const std::string& key, LockingScriptCacheData* data);
+
+  /**
+   * @brief Store an entry.
+   * @param[in] key     cache key
+   * @param[in] data    data
+   */
+  void StoreEntry(std::string key, const LockingScriptCacheData& data);
+
+  /**
+   * @brief Evict entries over the capacity. (need lock)
+   */
+  void Shrink();
+
+  mutable std::mutex mutex_;  //!< mutex
+  size_t capacity_;           //!< max entry count
+  EntryList entries_;         //!< entry list
+  //! key to entry map
+  std::unordered_map<std::string, EntryList::iterator> entry_map_;
+  uint64_t hit_count_;   //!< hit count
+  uint64_t miss_count_;  //!< miss count
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_SRC_CFDJS_LOCKING_SCRIPT_CACHE_H_
@@ -0,0 +1,99 @@
+// Copyright 2021 CryptoGarage
+/**
+ * @file cfdjs_parallel.cpp
+ *
+ * @brief Implementation of the parallel task executor.
+ */
+#include "cfdjs_parallel.h"  // NOLINT
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <vector>
+#ifndef __EMSCRIPTEN__
+#include <system_error>
+#include <thread>  // NOLINT
+#endif  // __EMSCRIPTEN__
+
+namespace cfd {
+namespace js {
+namespace api {
+
+/**
+ * @brief Execute the tasks taken from the shared counter.
+ * @param[in] task            task function
+ * @param[in] task_count      task count
+ * @param[in] worker_index    worker index
+ * @param[in,out] next_index  next task index
+ * @param[out] exceptions     exception of each task
+ */
+static void ExecuteWorker(
+    const std::function<void(size_t, uint32_t)>* task, size_t task_count,
+    uint32_t worker_index, std::atomic<size_t>* next_index,
+    std::vector<std::exception_ptr>* exceptions) {
+  while (true) {
+    size_t index = next_index->fetch_add(1);
+    if (index >= task_count) break;
+    try {
+      (*task)(index, worker_index);
+    } catch (...) {
+      (*exceptions)[index] = std::current_exception();
+    }
+  }
+}
+
+uint32_t ParallelExecutor::GetThreadCount(
+    uint32_t thread_count, size_t task_count) {
+#ifdef __EMSCRIPTEN__
+  thread_count = 1;  // no thread support
+#else
+  if (thread_count == 0) {
+    thread_count = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+  }
+#endif  // __EMSCRIPTEN__
+  if (thread_count > task_count) {
+    thread_count = static_cast<uint32_t>(std::max<size_t>(task_count, 1));
+  }
+  return thread_count;
+}
+
+void ParallelExecutor::Execute(
+    size_t task_count, uint32_t thread_count,
+    const std::function<void(size_t)>& task) {
+  ExecuteWithWorker(
+      task_count, thread_count,
+      [&task](size_t index, uint32_t) { task(index); });
+}
+
+void ParallelExecutor::ExecuteWithWorker(
+    size_t task_count, uint32_t thread_count,
+    const std::function<void(size_t, uint32_t)>& task) {
+  if (task_count == 0) return;
+  std::vector<std::exception_ptr> exceptions(task_count);
+  std::atomic<size_t> next_index(0);
+  thread_count = GetThreadCount(thread_count, task_count);
+
+#ifndef __EMSCRIPTEN__
+  std::vector<std::thread> threads;
+  for (uint32_t index = 1; index < thread_count; ++index) {
+    try {
+      threads.emplace_back(
+          ExecuteWorker, &task, task_count, index, &next_index, &exceptions);
+    } catch (const std::system_error&) {
+      break;  // the remaining tasks are executed by the other workers.
+    }
+  }
+#endif  // __EMSCRIPTEN__
+  ExecuteWorker(&task, task_count, 0, &next_index, &exceptions);
+#ifndef __EMSCRIPTEN__
+  for (auto& thread : threads) thread.join();
+#endif  // __EMSCRIPTEN__
+
+  for (const auto& exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+}
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
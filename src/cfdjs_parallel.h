@@ -0,0 +1,66 @@
+// Copyright 2021 CryptoGarage
+/**
+ * @file cfdjs_parallel.h
+ *
+ * @brief Definition of the parallel task executor.
+ */
+#ifndef CFD_JS_SRC_CFDJS_PARALLEL_H_
+#define CFD_JS_SRC_CFDJS_PARALLEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace cfd {
+namespace js {
+namespace api {
+
+/**
+ * @brief Executor of independent tasks on worker threads.
+ * @details Tasks are taken in index order from a shared counter, and the
+ *     calling thread works as one of the workers. On wasm, all tasks run on
+ *     the calling thread.
+ */
+class ParallelExecutor {
+ public:
+  /**
+   * @brief Get the worker thread count.
+   * @param[in] thread_count  requested thread count (0: hardware threads)
+   * @param[in] task_count    task count
+   * @return worker thread count (including the calling thread)
+   */
+  static uint32_t GetThreadCount(uint32_t thread_count, size_t task_count);
+
+  /**
+   * @brief Execute tasks.
+   * @details When tasks throw, the exception of the lowest task index is
+   *     rethrown after all workers finish.
+   * @param[in] task_count    task count
+   * @param[in] thread_count  thread count (0: hardware threads)
+   * @param[in] task          task function (argument is the task index)
+   */
+  static void Execute(
+      size_t task_count, uint32_t thread_count,
+      const std::function<void(size_t)>& task);
+  /**
+   * @brief Execute tasks with the worker index.
+   * @details Same as Execute, and the task also receives the index of the
+   *     running worker (less than GetThreadCount), so that workers can use
+   *     their own copy of non-thread-safe state.
+   * @param[in] task_count    task count
+   * @param[in] thread_count  thread count (0: hardware threads)
+   * @param[in] task          task function (task index, worker index)
+   */
+  static void ExecuteWithWorker(
+      size_t task_count, uint32_t thread_count,
+      const std::function<void(size_t, uint32_t)>& task);
+
+ private:
+  ParallelExecutor();
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_SRC_CFDJS_PARALLEL_H_
@@ -14,13 +14,17 @@
 #include "autogen/cfd_js_api_json_autogen.h"
 #include "cfd/cfd_address.h"
 #include "cfd/cfd_psbt.h"
+#include "cfd/cfd_transaction.h"
 #include "cfdcore/cfdcore_script.h"
+#include "cfdcore/cfdcore_transaction_common.h"
 #include "cfdcore/cfdcore_util.h"
 #include "cfdjs/cfdjs_api_address.h"
 #include "cfdjs/cfdjs_api_psbt.h"
 #include "cfdjs/cfdjs_api_transaction.h"
 #include "cfdjs_internal.h"          // NOLINT
 #include "cfdjs_json_transaction.h"  // NOLINT
+#include "cfdjs_parallel.h"          // NOLINT
+#include "cfdjs_psbt_merge.h"        // NOLINT
 #include "cfdjs_transaction_base.h"  // NOLINT
 
 namespace cfd {
@@ -29,6 +33,7 @@ namespace api {
 
 using cfd::AddressFactory;
 using cfd::Psbt;
+using cfd::TransactionContext;
 using cfd::core::Address;
 using cfd::core::AddressType;
 using cfd::core::Amount;
@@ -38,9 +43,12 @@ using cfd::core::ByteData160;
 using cfd::core::ByteData256;
 using cfd::core::CfdError;
 using cfd::core::CfdException;
+using cfd::core::CryptoUtil;
 using cfd::core::ExtPrivkey;
 using cfd::core::ExtPubkey;
 using cfd::core::HashType;
+using cfd::core::HashUtil;
+using cfd::core::KeyData;
 using cfd::core::NetType;
 using cfd::core::Privkey;
 using cfd::core::Pubkey;
@@ -50,9 +58,11 @@ using cfd::core::ScriptElement;
 using cfd::core::ScriptUtil;
 using cfd::core::SigHashAlgorithm;
 using cfd::core::SigHashType;
+using cfd::core::SignatureUtil;
 using cfd::core::StringUtil;
 using cfd::core::Transaction;
 using cfd::core::Txid;
+using cfd::core::WitnessVersion;
 using cfd::core::logger::info;
 using cfd::core::logger::warn;
 
@@ -84,6 +94,47 @@ static void GetPsbtFromString(
   }
 }
 
+/**
+ * @brief get psbt binary from string.
+ * @param[in] psbt_string   psbt string (base64 or hex)
+ * @return psbt binary (empty if decoding is failed)
+ */
+static std::vector<uint8_t> GetPsbtBytesFromString(
+    const std::string& psbt_string) {
+  static const std::string kPsbtHexMagic = "70736274ff";
+  try {
+    if (psbt_string.compare(0, kPsbtHexMagic.size(), kPsbtHexMagic) == 0) {
+      return StringUtil::StringToByte(psbt_string);
+    }
+    return CryptoUtil::DecodeBase64(psbt_string).GetBytes();
+  } catch (const CfdException&) {
+    return std::vector<uint8_t>();
+  }
+}
+
+/**
+ * @brief get the decode target flags of psbt inputs or outputs.
+ * @param[in] indexes   target index list (empty: all)
+ * @param[in] count     input or output count
+ * @return target flag list
+ */
+static std::vector<bool> GetDecodePsbtTargets(
+    const std::vector<uint32_t>& indexes, uint32_t count) {
+  if (indexes.empty()) return std::vector<bool>(count, true);
+  std::vector<bool> result(count, false);
+  for (const auto index : indexes) {
+    if (index >= count) {
+      warn(
+          CFD_LOG_SOURCE, "Failed to DecodePsbt. index out of range.: {}/{}",
+          index, count);
+      throw CfdException(
+          CfdError::kCfdOutOfRangeError, "index is out of range.");
+    }
+    result[index] = true;
+  }
+  return result;
+}
+
 /**
  * @brief Parse psbt's input request data.
  * @param[in] data              input data
@@ -380,6 +431,179 @@ void AddPsbtOutput(Psbt* psbt, const PsbtAddOutputRequestStruct& request) {
   }
 }
 
+/**
+ * @brief Psbt txin signing data.
+ */
+struct PsbtSignData {
+  uint32_t index = 0;        //!< txin index
+  KeyData key;               //!< bip32 derivation key
+  Privkey privkey;           //!< private key
+  SigHashType sighash_type;  //!< sighash type
+  ByteData256 sighash;       //!< sighash
+  ByteData signature;        //!< der encoded signature
+};
+
+/**
+ * @brief get privkey from string.
+ * @param[in] privkey   privkey string (hex or wif)
+ * @return privkey
+ */
+static Privkey GetPrivkeyFromString(const std::string& privkey) {
+  if (privkey.length() == Privkey::kPrivkeySize * 2) {
+    return Privkey(privkey);
+  }
+  return Privkey::FromWif(privkey);
+}
+
+/**
+ * @brief get psbt txin sighash.
+ * @param[in] psbt          psbt
+ * @param[in] index         txin index
+ * @param[in] outpoint      txin outpoint
+ * @param[in] pubkey        signing pubkey
+ * @param[in,out] tx        transaction context of psbt
+ * @param[out] sighash_type sighash type
+ * @param[out] sighash      sighash
+ * @retval true   supported script
+ * @retval false  unsupported script (taproot)
+ */
+static bool GetPsbtTxInSighash(
+    const Psbt& psbt, uint32_t index, const OutPoint& outpoint,
+    const Pubkey& pubkey, TransactionContext* tx, SigHashType* sighash_type,
+    ByteData256* sighash) {
+  *sighash_type = SigHashType();
+  if (psbt.IsFindTxInSighashType(index)) {
+    *sighash_type = psbt.GetTxInSighashType(index);
+  }
+  bool is_witness = false;
+  TxOut utxo = psbt.GetTxInUtxo(index, true, &is_witness);
+  const Script& locking_script = utxo.GetLockingScript();
+  if (locking_script.IsTaprootScript()) return false;
+  Script witness_script = psbt.GetTxInRedeemScriptDirect(index, true, true);
+  Script redeem_script = psbt.GetTxInRedeemScriptDirect(index, true, false);
+
+  ByteData data;
+  if (!witness_script.IsEmpty()) {
+    data = tx->CreateSignatureHash(
+        outpoint, witness_script, *sighash_type, utxo.GetValue(),
+        WitnessVersion::kVersion0);
+  } else if (
+      locking_script.IsP2wpkhScript() || redeem_script.IsP2wpkhScript()) {
+    data = tx->CreateSignatureHash(
+        outpoint, pubkey, *sighash_type, utxo.GetValue(),
+        WitnessVersion::kVersion0);
+  } else if (!redeem_script.IsEmpty()) {
+    data = tx->CreateSignatureHash(
+        outpoint, redeem_script, *sighash_type, utxo.GetValue(),
+        WitnessVersion::kVersionNone);
+  } else {
+    data = tx->CreateSignatureHash(
+        outpoint, pubkey, *sighash_type, utxo.GetValue(),
+        WitnessVersion::kVersionNone);
+  }
+  *sighash = ByteData256(data.GetBytes());
+  return true;
+}
+
+/**
+ * @brief derive the privkey of a bip32 derivation record from the xprv.
+ * @details A master xprv (depth 0) is matched by the master fingerprint and
+ *     derives the whole path. Any other xprv is matched by the path prefix:
+ *     the path element at the xprv depth must be the xprv child number, and
+ *     the rest of the path is derived from the xprv. The path elements above
+ *     the xprv cannot be checked, so the derived pubkey is always compared.
+ * @param[in] xprv              extended privkey
+ * @param[in] xprv_fingerprint  fingerprint of the xprv
+ * @param[in] key               bip32 derivation record
+ * @param[out] privkey          derived privkey
+ * @retval true   matched
+ * @retval false  not matched
+ */
+static bool DerivePsbtKeyPrivkey(
+    const ExtPrivkey& xprv, const ByteData& xprv_fingerprint,
+    const KeyData& key, Privkey* privkey) {
+  std::vector<uint32_t> path = key.GetChildNumArray();
+  uint32_t depth = xprv.GetDepth();
+  std::vector<uint32_t> child_path;
+  if (depth == 0) {
+    if (!key.GetFingerprint().Equals(xprv_fingerprint)) return false;
+    child_path = path;
+  } else {
+    if ((path.size() < depth) || (path[depth - 1] != xprv.GetChildNum())) {
+      return false;
+    }
+    child_path.assign(path.begin() + depth, path.end());
+  }
+  Privkey derived_key = (child_path.empty())
+                            ? xprv.GetPrivkey()
+                            : xprv.DerivePrivkey(child_path).GetPrivkey();
+  if (!derived_key.GeneratePubkey().Equals(key.GetPubkey())) return false;
+  *privkey = derived_key;
+  return true;
+}
+
+/**
+ * @brief collect the signing data of the txins matched to the keys.
+ * @details The txins are matched by the bip32 derivation records.
+ *     Taproot txins are not signed and are skipped with a warning log.
+ * @param[in] psbt      psbt
+ * @param[in] privkeys  privkey list
+ * @param[in] xprv      extended privkey (nullable)
+ * @return signing data list
+ */
+static std::vector<PsbtSignData> CollectPsbtSignData(
+    const Psbt& psbt, const std::vector<Privkey>& privkeys,
+    const ExtPrivkey* xprv) {
+  std::vector<Pubkey> pubkeys;
+  for (const auto& privkey : privkeys) {
+    pubkeys.push_back(privkey.GeneratePubkey());
+  }
+  ByteData xprv_fingerprint;
+  if (xprv != nullptr) {
+    auto hash = HashUtil::Hash160(xprv->GetPubkey()).GetBytes();
+    xprv_fingerprint = ByteData(
+        std::vector<uint8_t>(hash.begin(), hash.begin() + 4));
+  }
+
+  std::vector<PsbtSignData> result;
+  TransactionContext tx = psbt.GetTransactionContext();
+  uint32_t txin_count = psbt.GetTxInCount();
+  for (uint32_t index = 0; index < txin_count; ++index) {
+    OutPoint outpoint = tx.GetTxIn(index).GetOutPoint();
+    if (psbt.IsFinalizedInput(outpoint)) continue;
+    for (const auto& key : psbt.GetTxInKeyDataList(index)) {
+      PsbtSignData data;
+      bool is_find = false;
+      for (size_t key_index = 0; key_index < pubkeys.size(); ++key_index) {
+        if (pubkeys[key_index].Equals(key.GetPubkey())) {
+          data.privkey = privkeys[key_index];
+          is_find = true;
+          break;
+        }
+      }
+      if ((!is_find) && (xprv != nullptr)) {
+        is_find =
+            DerivePsbtKeyPrivkey(*xprv, xprv_fingerprint, key, &data.privkey);
+      }
+      if (!is_find) continue;
+
+      data.index = index;
+      data.key = key;
+      if (GetPsbtTxInSighash(
+              psbt, index, outpoint, key.GetPubkey(), &tx,
+              &data.sighash_type, &data.sighash)) {
+        result.push_back(data);
+      } else {
+        warn(
+            CFD_LOG_SOURCE,
+            "SignPsbt skips the taproot input. not supported: index={}",
+            index);
+      }
+    }
+  }
+  return result;
+}
+
 // -----------------------------------------------------------------------------
 // PsbtStructApi class
 // -----------------------------------------------------------------------------
@@ -391,100 +615,167 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
     GetPsbtFromString(request.psbt, "DecodePsbt", &psbt);
 
     auto net_type = AddressStructApi::ConvertNetType(request.network);
-    AddressFactory addr_factory(net_type);
 
     Transaction tx = psbt.GetTransaction();
     DecodePsbtResponseStruct response;
+    auto input_targets =
+        GetDecodePsbtTargets(request.input_indexes, tx.GetTxInCount());
+    auto output_targets =
+        GetDecodePsbtTargets(request.output_indexes, tx.GetTxOutCount());
+    auto to_asm = [&request](const Script& script) -> std::string {
+      return (request.skip_asm) ? std::string() : script.ToString();
+    };
 
     DecodeRawTransactionRequestStruct tx_req;
     DecodeRawTransactionResponseStruct tx_res;
 
     // global
-    tx_req.hex = tx.GetHex();
     tx_req.network = request.network;
-    tx_res = TransactionStructApi::DecodeRawTransaction(tx_req);
-    response.tx = tx_res;
-    if (request.has_detail) {
-      response.tx_hex = tx_req.hex;
-      if (request.has_simple) response.ignore_items.emplace("tx");
-    } else {
+    tx_req.skip_asm = request.skip_asm;
+    if (request.has_summary) {
+      response.ignore_items.emplace("tx");
       response.ignore_items.emplace("tx_hex");
-    }
-
-    auto key_list = psbt.GetGlobalRecordKeyList();
-    if (request.has_detail) {
-      response.version = psbt.GetPsbtVersion();
-      auto xpub_list = psbt.GetGlobalXpubkeyDataList();
-      for (const auto& xpub : xpub_list) {
-        PsbtGlobalXpubStruct item;
-        const auto& extkey = xpub.GetExtPubkey();
-        item.xpub.base58 = extkey.ToString();
-        item.xpub.hex = extkey.GetData().GetHex();
-        item.path = xpub.GetBip32Path();
-        item.master_fingerprint = xpub.GetFingerprint().GetHex();
-        item.descriptor_xpub = xpub.ToString();
-        response.xpubs.emplace_back(item);
-      }
-      if (response.xpubs.empty()) response.ignore_items.emplace("xpubs");
-    } else {
       response.ignore_items.emplace("version");
       response.ignore_items.emplace("xpubs");
-      if (psbt.GetPsbtVersion() > 0) key_list.push_back(ByteData("fb"));
-    }
+      response.ignore_items.emplace("unknown");
+      response.ignore_items.emplace("inputs");
+      response.ignore_items.emplace("outputs");
+      response.input_count = tx.GetTxInCount();
+      response.output_count = tx.GetTxOutCount();
+    } else {
+      response.ignore_items.emplace("input_count");
+      response.ignore_items.emplace("output_count");
+      response.ignore_items.emplace("signed_input_count");
+      response.ignore_items.emplace("finalized_input_count");
+
+      tx_req.hex = tx.GetHex();
+      tx_res = TransactionStructApi::DecodeRawTransaction(tx_req);
+      response.tx = tx_res;
+      if (request.has_detail) {
+        response.tx_hex = tx_req.hex;
+        if (request.has_simple) response.ignore_items.emplace("tx");
+      } else {
+        response.ignore_items.emplace("tx_hex");
+      }
 
-    auto& unknown_list = response.unknown;
-    for (const auto& key : key_list) {
-      if (request.has_detail && (key.GetHeadData() == Psbt::kPsbtGlobalXpub)) {
-        continue;
+      auto key_list = psbt.GetGlobalRecordKeyList();
+      if (request.has_detail) {
+        response.version = psbt.GetPsbtVersion();
+        auto xpub_list = psbt.GetGlobalXpubkeyDataList();
+        for (const auto& xpub : xpub_list) {
+          PsbtGlobalXpubStruct item;
+          const auto& extkey = xpub.GetExtPubkey();
+          item.xpub.base58 = extkey.ToString();
+          item.xpub.hex = extkey.GetData().GetHex();
+          item.path = xpub.GetBip32Path();
+          item.master_fingerprint = xpub.GetFingerprint().GetHex();
+          item.descriptor_xpub = xpub.ToString();
+          response.xpubs.emplace_back(item);
+        }
+        if (response.xpubs.empty()) response.ignore_items.emplace("xpubs");
+      } else {
+        response.ignore_items.emplace("version");
+        response.ignore_items.emplace("xpubs");
+        if (psbt.GetPsbtVersion() > 0) key_list.push_back(ByteData("fb"));
+      }
+
+      auto& unknown_list = response.unknown;
+      for (const auto& key : key_list) {
+        if (request.has_detail &&
+            (key.GetHeadData() == Psbt::kPsbtGlobalXpub)) {
+          continue;
+        }
+        PsbtMapDataStruct item;
+        auto data = psbt.GetGlobalRecord(key);
+        item.key = key.GetHex();
+        item.value = data.GetHex();
+        unknown_list.emplace_back(item);
+      }
+      if (request.has_simple && unknown_list.empty()) {
+        response.ignore_items.emplace("unknown");
       }
-      PsbtMapDataStruct item;
-      auto data = psbt.GetGlobalRecord(key);
-      item.key = key.GetHex();
-      item.value = data.GetHex();
-      unknown_list.emplace_back(item);
-    }
-    if (request.has_simple && unknown_list.empty()) {
-      response.ignore_items.emplace("unknown");
     }
 
     Amount total_input;
     bool is_unset_utxo = false;
     for (uint32_t index = 0; index < tx.GetTxInCount(); ++index) {
-      DecodePsbtInputStruct input;
       auto tx_input = tx.GetTxIn(index);
+      bool is_decode = (!request.has_summary) && input_targets[index];
       bool has_amount = false;
       bool is_witness = false;
 
       auto utxo = psbt.GetTxInUtxo(index, true, &is_witness);
-      if (utxo.GetLockingScript().IsEmpty() || (!is_witness)) {
-        input.ignore_items.emplace("witness_utxo");
-      } else {
+      bool has_witness_utxo =
+          (!utxo.GetLockingScript().IsEmpty()) && is_witness;
+      if (has_witness_utxo) {
         has_amount = true;
         total_input += utxo.GetValue();
+      }
+
+      // The full utxo transaction is parsed only when it is used.
+      Transaction full_utxo;
+      bool has_full_utxo = false;
+      if (is_decode || (!has_amount)) {
+        full_utxo = psbt.GetTxInUtxoFull(index, true);
+        has_full_utxo = full_utxo.GetTxid().Equals(tx_input.GetTxid());
+      }
+      if (has_amount) {
+        // do nothing
+      } else if (
+          has_full_utxo &&
+          (full_utxo.GetTxOutCount() > tx_input.GetVout())) {
+        auto txout = full_utxo.GetTxOut(tx_input.GetVout());
+        total_input += txout.GetValue();
+        has_amount = true;
+      } else {
+        is_unset_utxo = true;
+      }
+
+      if (request.has_summary) {
+        if (!psbt.GetTxInSignaturePubkeyList(index).empty()) {
+          ++response.signed_input_count;
+        }
+        if (psbt.IsFinalizedInput(tx_input.GetOutPoint())) {
+          ++response.finalized_input_count;
+        }
+      }
+      if (!is_decode) continue;
+
+      DecodePsbtInputStruct input;
+      if (request.input_indexes.empty()) {
+        input.ignore_items.emplace("index");
+      } else {
+        input.index = index;
+      }
+
+      if (!has_witness_utxo) {
+        input.ignore_items.emplace("witness_utxo");
+      } else {
         input.witness_utxo.amount = utxo.GetValue().GetSatoshiValue();
         auto& script = input.witness_utxo.script_pub_key;
 
         std::string script_type;
         auto addr_list = TransactionStructApi::ConvertFromLockingScript(
-            addr_factory, utxo.GetLockingScript(), &script_type, nullptr);
+            net_type, utxo.GetLockingScript(), &script_type, nullptr);
         if (!addr_list.empty()) {
           script.address = addr_list[0].GetAddress();
         }
         script.hex = utxo.GetLockingScript().GetHex();
-        script.asm_ = utxo.GetLockingScript().ToString();
+        script.asm_ = to_asm(utxo.GetLockingScript());
         script.type = script_type;
       }
 
-      auto full_utxo = psbt.GetTxInUtxoFull(index, true);
-      if (!full_utxo.GetTxid().Equals(tx_input.GetTxid())) {
+      if (!has_full_utxo) {
         input.ignore_items.emplace("non_witness_utxo");
         input.ignore_items.emplace("non_witness_utxo_hex");
-        if (!has_amount) is_unset_utxo = true;
       } else {
         tx_req.hex = full_utxo.GetHex();
-        tx_req.network = request.network;
-        tx_res = TransactionStructApi::DecodeRawTransaction(tx_req);
-        input.non_witness_utxo = tx_res;
+        if (request.skip_utxo_transaction) {
+          input.ignore_items.emplace("non_witness_utxo");
+        } else {
+          tx_res = TransactionStructApi::DecodeRawTransaction(tx_req);
+          input.non_witness_utxo = tx_res;
+        }
         if (request.has_detail) {
           input.non_witness_utxo_hex = tx_req.hex;
           if (input.non_witness_utxo_hex.empty()) {
@@ -496,16 +787,7 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
         } else {
           input.ignore_items.emplace("non_witness_utxo_hex");
         }
-        if (has_amount) {
-          // do nothing
-        } else if (full_utxo.GetTxOutCount() > tx_input.GetVout()) {
-          auto txout = full_utxo.GetTxOut(tx_input.GetVout());
-          total_input += txout.GetValue();
-          has_amount = true;
-        } else {
-          input.ignore_items.emplace("non_witness_utxo");
-          is_unset_utxo = true;
-        }
+        if (!has_amount) input.ignore_items.emplace("non_witness_utxo");
       }
 
       auto sig_pubkey_list = psbt.GetTxInSignaturePubkeyList(index);
@@ -535,9 +817,9 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
         input.ignore_items.emplace("redeem_script");
       } else {
         auto addr_list = TransactionStructApi::ConvertFromLockingScript(
-            addr_factory, redeem_script, &input.redeem_script.type, nullptr);
+            net_type, redeem_script, &input.redeem_script.type, nullptr);
         input.redeem_script.hex = redeem_script.GetHex();
-        input.redeem_script.asm_ = redeem_script.ToString();
+        input.redeem_script.asm_ = to_asm(redeem_script);
       }
 
       Script witness_script =
@@ -546,9 +828,9 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
         input.ignore_items.emplace("witness_script");
       } else {
         auto addr_list = TransactionStructApi::ConvertFromLockingScript(
-            addr_factory, witness_script, &input.witness_script.type, nullptr);
+            net_type, witness_script, &input.witness_script.type, nullptr);
         input.witness_script.hex = witness_script.GetHex();
-        input.witness_script.asm_ = witness_script.ToString();
+        input.witness_script.asm_ = to_asm(witness_script);
       }
 
       auto bip32_pubkey_list = psbt.GetTxInKeyDataList(index);
@@ -573,7 +855,7 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
       auto scriptsig_arr = psbt.GetTxInFinalScript(index, false);
       if ((!scriptsig_arr.empty()) && (!scriptsig_arr[0].IsEmpty())) {
         input.final_scriptsig.hex = scriptsig_arr[0].GetHex();
-        input.final_scriptsig.asm_ = Script(scriptsig_arr[0]).ToString();
+        input.final_scriptsig.asm_ = to_asm(Script(scriptsig_arr[0]));
       } else {
         input.ignore_items.emplace("final_scriptsig");
       }
@@ -587,7 +869,7 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
         }
       }
 
-      key_list = psbt.GetTxInRecordKeyList(index);
+      auto key_list = psbt.GetTxInRecordKeyList(index);
       for (const auto& key : key_list) {
         PsbtMapDataStruct item;
         auto data = psbt.GetTxInRecord(index, key);
@@ -602,9 +884,16 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
 
     Amount total_output;
     for (uint32_t index = 0; index < tx.GetTxOutCount(); ++index) {
-      DecodePsbtOutputStruct output;
       const auto& txout = tx.GetTxOut(index);
       total_output += txout.GetValue();
+      if (request.has_summary || (!output_targets[index])) continue;
+
+      DecodePsbtOutputStruct output;
+      if (request.output_indexes.empty()) {
+        output.ignore_items.emplace("index");
+      } else {
+        output.index = index;
+      }
       bool is_witness = false;
       auto script = psbt.GetTxOutScript(index, true, &is_witness);
       if (script.IsEmpty()) {
@@ -612,18 +901,18 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
         output.ignore_items.emplace("witness_script");
       } else if (is_witness) {
         output.witness_script.hex = script.GetHex();
-        output.witness_script.asm_ = script.ToString();
+        output.witness_script.asm_ = to_asm(script);
         if (txout.GetLockingScript().IsP2shScript()) {
           auto sh_script = ScriptUtil::CreateP2wshLockingScript(script);
           output.redeem_script.hex = sh_script.GetHex();
-          output.redeem_script.asm_ = sh_script.ToString();
+          output.redeem_script.asm_ = to_asm(sh_script);
         } else {
           output.ignore_items.emplace("redeem_script");
         }
       } else {
         output.ignore_items.emplace("witness_script");
         output.redeem_script.hex = script.GetHex();
-        output.redeem_script.asm_ = script.ToString();
+        output.redeem_script.asm_ = to_asm(script);
       }
 
       auto bip32_pubkey_list = psbt.GetTxOutKeyDataList(index);
@@ -645,7 +934,7 @@ DecodePsbtResponseStruct PsbtStructApi::DecodePsbt(
         }
       }
 
-      key_list = psbt.GetTxOutRecordKeyList(index);
+      auto key_list = psbt.GetTxOutRecordKeyList(index);
       for (const auto& key : key_list) {
         PsbtMapDataStruct item;
         auto data = psbt.GetTxOutRecord(index, key);
@@ -764,6 +1053,23 @@ PsbtOutputDataStruct PsbtStructApi::CombinePsbt(
       throw CfdException(
           CfdError::kCfdIllegalArgumentError, "psbt list is empty.");
     }
+    PsbtOutputDataStruct response;
+    if (request.psbts.size() > 1) {
+      // Merge the records of all psbts at once. If any psbt cannot be
+      // merged, the pairwise combine below reports the error.
+      PsbtRecordMerger merger;
+      for (const auto& psbt_string : request.psbts) {
+        if (!merger.Add(GetPsbtBytesFromString(psbt_string))) break;
+      }
+      if (merger.GetCount() == request.psbts.size()) {
+        ByteData merged_data(merger.Serialize());
+        Psbt merged_psbt(merged_data);
+        response.psbt = merged_psbt.GetBase64();
+        response.hex = merged_psbt.GetData().GetHex();
+        return response;
+      }
+    }
+
     Psbt psbt;
     GetPsbtFromString(request.psbts.at(0), "CombinePsbt", &psbt);
 
@@ -773,7 +1079,6 @@ PsbtOutputDataStruct PsbtStructApi::CombinePsbt(
       psbt.Combine(append_psbt);
     }
 
-    PsbtOutputDataStruct response;
     response.psbt = psbt.GetBase64();
     response.hex = psbt.GetData().GetHex();
     return response;
@@ -869,13 +1174,43 @@ PsbtOutputDataStruct PsbtStructApi::SignPsbt(
       -> PsbtOutputDataStruct {  // NOLINT
     Psbt psbt;
     GetPsbtFromString(request.psbt, "SignPsbt", &psbt);
-    Privkey privkey;
-    if (request.privkey.length() == Privkey::kPrivkeySize * 2) {
-      privkey = Privkey(request.privkey);
+    if (request.privkeys.empty() && request.xprv.empty()) {
+      psbt.Sign(GetPrivkeyFromString(request.privkey), request.has_grind_r);
     } else {
-      privkey = Privkey::FromWif(request.privkey);
+      std::vector<Privkey> privkeys;
+      if (!request.privkey.empty()) {
+        privkeys.push_back(GetPrivkeyFromString(request.privkey));
+      }
+      for (const auto& privkey : request.privkeys) {
+        privkeys.push_back(GetPrivkeyFromString(privkey));
+      }
+      ExtPrivkey xprv;
+      if (!request.xprv.empty()) xprv = ExtPrivkey(request.xprv);
+      std::vector<PsbtSignData> sign_list = CollectPsbtSignData(
+          psbt, privkeys, (request.xprv.empty()) ? nullptr : &xprv);
+      if (sign_list.empty()) {
+        warn(CFD_LOG_SOURCE, "Failed to SignPsbt. signing key not found.");
+        throw CfdException(
+            CfdError::kCfdIllegalArgumentError,
+            "Failed to SignPsbt. signing key not found.");
+      }
+
+      // Only the signing runs in parallel. The psbt is updated afterwards
+      // in the txin order and serialized once.
+      bool has_grind_r = request.has_grind_r;
+      ParallelExecutor::Execute(
+          sign_list.size(), request.thread_count,
+          [&sign_list, has_grind_r](size_t index) {
+            PsbtSignData& data = sign_list[index];
+            ByteData signature = SignatureUtil::CalculateEcSignature(
+                data.sighash, data.privkey, has_grind_r);
+            data.signature =
+                CryptoUtil::ConvertSignatureToDer(signature, data.sighash_type);
+          });
+      for (const auto& data : sign_list) {
+        psbt.SetTxInSignature(data.index, data.key, data.signature);
+      }
     }
-    psbt.Sign(privkey, request.has_grind_r);
 
     PsbtOutputDataStruct response;
     response.psbt = psbt.GetBase64();
@@ -908,20 +1243,52 @@ VerifySignResponseStruct PsbtStructApi::VerifyPsbtSign(
       }
     }
 
-    for (const auto& outpoint : outpoints) {
-      try {
-        psbt.Verify(outpoint);
-      } catch (const CfdException& except) {
-        std::string error_msg = std::string(except.what());
-        warn(CFD_LOG_SOURCE, "Failed to VerifyPsbtSign. {}", error_msg);
-        response.success = false;
-        FailSignTxInStruct fail_data;
-        fail_data.txid = outpoint.GetTxid().GetHex();
-        fail_data.vout = outpoint.GetVout();
-        fail_data.reason = error_msg;
-        response.fail_txins.emplace_back(fail_data);
+    // The finalized transaction and the utxos are collected once, and each
+    // worker verifies the txins on its own copy of the context.
+    Transaction final_tx = tx;
+    for (uint32_t index = 0; index < final_tx.GetTxInCount(); ++index) {
+      auto scriptsig_arr = psbt.GetTxInFinalScript(index, false);
+      if ((!scriptsig_arr.empty()) && (!scriptsig_arr[0].IsEmpty())) {
+        final_tx.SetUnlockingScript(index, Script(scriptsig_arr[0]));
+      }
+      for (const auto& witness : psbt.GetTxInFinalScript(index, true)) {
+        final_tx.AddScriptWitnessStack(index, witness);
       }
     }
+    TransactionContext context(final_tx.GetHex());
+    context.CollectInputUtxo(psbt.GetUtxoDataAll(NetType::kMainnet));
+    std::vector<TransactionContext> contexts(
+        ParallelExecutor::GetThreadCount(
+            request.thread_count, outpoints.size()),
+        context);
+
+    std::vector<std::string> reasons(outpoints.size());
+    ParallelExecutor::ExecuteWithWorker(
+        outpoints.size(), request.thread_count,
+        [&psbt, &outpoints, &contexts, &reasons](
+            size_t index, uint32_t worker_index) {
+          try {
+            if (!psbt.IsFinalizedInput(outpoints[index])) {
+              reasons[index] = "psbt txin not finalized yet.";
+            } else {
+              contexts[worker_index].Verify(outpoints[index]);
+            }
+          } catch (const CfdException& except) {
+            reasons[index] = std::string(except.what());
+          }
+        });
+
+    for (size_t index = 0; index < outpoints.size(); ++index) {
+      if (reasons[index].empty()) continue;
+      const OutPoint& outpoint = outpoints[index];
+      warn(CFD_LOG_SOURCE, "Failed to VerifyPsbtSign. {}", reasons[index]);
+      response.success = false;
+      FailSignTxInStruct fail_data;
+      fail_data.txid = outpoint.GetTxid().GetHex();
+      fail_data.vout = outpoint.GetVout();
+      fail_data.reason = reasons[index];
+      response.fail_txins.emplace_back(fail_data);
+    }
 
     response.success = response.fail_txins.empty();
     if (response.success) response.ignore_items.emplace("failTxins");
@@ -0,0 +1,272 @@
+// Copyright 2021 CryptoGarage
+/**
+ * @file cfdjs_psbt_merge.cpp
+ *
+ * @brief Implementation of the N-way psbt record merger.
+ */
+#include "cfdjs_psbt_merge.h"  // NOLINT
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace cfd {
+namespace js {
+namespace api {
+
+//! psbt magic bytes ("psbt" + 0xff)
+static const uint8_t kPsbtMagic[] = {0x70, 0x73, 0x62, 0x74, 0xff};
+//! global unsigned transaction key type
+static constexpr uint8_t kPsbtGlobalUnsignedTx = 0x00;
+//! global version key type
+static constexpr uint8_t kPsbtGlobalVersion = 0xfb;
+
+/**
+ * @brief Sequential reader of a byte array.
+ */
+class PsbtByteReader {
+ public:
+  /**
+   * @brief constructor.
+   * @param[in] data    byte array
+   */
+  explicit PsbtByteReader(const std::vector<uint8_t>& data)
+      : data_(data), offset_(0) {}
+
+  /**
+   * @brief Check the end of data.
+   * @return true if all bytes are read
+   */
+  bool IsEnd() const { return offset_ >= data_.size(); }
+
+  /**
+   * @brief Skip bytes.
+   * @param[in] size    byte size
+   * @retval true   success
+   * @retval false  out of range
+   */
+  bool Skip(uint64_t size) {
+    if (size > data_.size() - offset_) return false;
+    offset_ += static_cast<size_t>(size);
+    return true;
+  }
+
+  /**
+   * @brief Read bytes.
+   * @param[in] size    byte size
+   * @param[out] bytes  read bytes
+   * @retval true   success
+   * @retval false  out of range
+   */
+  bool Read(uint64_t size, std::vector<uint8_t>* bytes) {
+    if (size > data_.size() - offset_) return false;
+    bytes->assign(
+        data_.begin() + offset_,
+        data_.begin() + offset_ + static_cast<size_t>(size));
+    offset_ += static_cast<size_t>(size);
+    return true;
+  }
+
+  /**
+   * @brief Read a compact size (variable length integer).
+   * @param[out] value  value
+   * @retval true   success
+   * @retval false  out of range
+   */
+  bool ReadCompactSize(uint64_t* value) {
+    if (IsEnd()) return false;
+    uint8_t head = data_[offset_++];
+    uint32_t size = 0;
+    if (head == 0xfd) {
+      size = 2;
+    } else if (head == 0xfe) {
+      size = 4;
+    } else if (head == 0xff) {
+      size = 8;
+    } else {
+      *value = head;
+      return true;
+    }
+    if (size > data_.size() - offset_) return false;
+    *value = 0;
+    for (uint32_t index = 0; index < size; ++index) {
+      *value |= static_cast<uint64_t>(data_[offset_++]) << (index * 8);
+    }
+    return true;
+  }
+
+ private:
+  const std::vector<uint8_t>& data_;  //!< byte array
+  size_t offset_;                     //!< read offset
+};
+
+/**
+ * @brief Write a compact size.
+ * @param[in] value   value
+ * @param[out] data   output byte array
+ */
+static void WriteCompactSize(uint64_t value, std::vector<uint8_t>* data) {
+  uint32_t size = 0;
+  if (value < 0xfd) {
+    data->push_back(static_cast<uint8_t>(value));
+    return;
+  } else if (value <= 0xffff) {
+    data->push_back(0xfd);
+    size = 2;
+  } else if (value <= 0xffffffff) {
+    data->push_back(0xfe);
+    size = 4;
+  } else {
+    data->push_back(0xff);
+    size = 8;
+  }
+  for (uint32_t index = 0; index < size; ++index) {
+    data->push_back(static_cast<uint8_t>(value >> (index * 8)));
+  }
+}
+
+/**
+ * @brief Read a psbt record map.
+ * @param[in,out] reader  byte reader
+ * @param[out] records    record map (the first record of a key is kept)
+ * @retval true   success
+ * @retval false  invalid format
+ */
+static bool ReadRecordMap(
+    PsbtByteReader* reader, PsbtRecordMerger::RecordMap* records) {
+  while (true) {
+    uint64_t key_size = 0;
+    if (!reader->ReadCompactSize(&key_size)) return false;
+    if (key_size == 0) return true;
+    std::vector<uint8_t> key;
+    std::vector<uint8_t> value;
+    uint64_t value_size = 0;
+    if (!reader->Read(key_size, &key) ||
+        !reader->ReadCompactSize(&value_size) ||
+        !reader->Read(value_size, &value)) {
+      return false;
+    }
+    records->emplace(key, value);
+  }
+}
+
+/**
+ * @brief Write a psbt record map.
+ * @param[in] records   record map
+ * @param[out] data     output byte array
+ */
+static void WriteRecordMap(
+    const PsbtRecordMerger::RecordMap& records, std::vector<uint8_t>* data) {
+  for (const auto& record : records) {
+    WriteCompactSize(record.first.size(), data);
+    data->insert(data->end(), record.first.begin(), record.first.end());
+    WriteCompactSize(record.second.size(), data);
+    data->insert(data->end(), record.second.begin(), record.second.end());
+  }
+  data->push_back(0);
+}
+
+/**
+ * @brief Get the txin and txout count of a non-witness transaction.
+ * @param[in] tx            transaction binary
+ * @param[out] txin_count   txin count
+ * @param[out] txout_count  txout count
+ * @retval true   success
+ * @retval false  invalid format
+ */
+static bool GetTransactionCount(
+    const std::vector<uint8_t>& tx, uint64_t* txin_count,
+    uint64_t* txout_count) {
+  PsbtByteReader reader(tx);
+  uint64_t size = 0;
+  if (!reader.Skip(4) || !reader.ReadCompactSize(txin_count)) return false;
+  for (uint64_t index = 0; index < *txin_count; ++index) {
+    // outpoint, scriptSig, sequence
+    if (!reader.Skip(36) || !reader.ReadCompactSize(&size) ||
+        !reader.Skip(size) || !reader.Skip(4)) {
+      return false;
+    }
+  }
+  if (!reader.ReadCompactSize(txout_count)) return false;
+  for (uint64_t index = 0; index < *txout_count; ++index) {
+    // amount, scriptPubkey
+    if (!reader.Skip(8) || !reader.ReadCompactSize(&size) ||
+        !reader.Skip(size)) {
+      return false;
+    }
+  }
+  // locktime
+  return reader.Skip(4) && reader.IsEnd();
+}
+
+PsbtRecordMerger::PsbtRecordMerger() : count_(0) {
+  // do nothing
+}
+
+bool PsbtRecordMerger::Add(const std::vector<uint8_t>& psbt) {
+  PsbtByteReader reader(psbt);
+  std::vector<uint8_t> magic;
+  if (!reader.Read(sizeof(kPsbtMagic), &magic) ||
+      !std::equal(magic.begin(), magic.end(), kPsbtMagic)) {
+    return false;
+  }
+
+  RecordMap global;
+  if (!ReadRecordMap(&reader, &global)) return false;
+  auto tx_ite = global.find(std::vector<uint8_t>{kPsbtGlobalUnsignedTx});
+  if (tx_ite == global.end()) return false;
+  auto version_ite = global.find(std::vector<uint8_t>{kPsbtGlobalVersion});
+  if ((version_ite != global.end()) &&
+      (version_ite->second != std::vector<uint8_t>(4, 0))) {
+    return false;
+  }
+  uint64_t txin_count = 0;
+  uint64_t txout_count = 0;
+  if (!GetTransactionCount(tx_ite->second, &txin_count, &txout_count)) {
+    return false;
+  }
+  if (count_ != 0) {
+    auto base_ite = global_.find(tx_ite->first);
+    if (base_ite->second != tx_ite->second) return false;
+  }
+
+  std::vector<RecordMap> inputs(static_cast<size_t>(txin_count));
+  std::vector<RecordMap> outputs(static_cast<size_t>(txout_count));
+  for (auto& input : inputs) {
+    if (!ReadRecordMap(&reader, &input)) return false;
+  }
+  for (auto& output : outputs) {
+    if (!ReadRecordMap(&reader, &output)) return false;
+  }
+  if (!reader.IsEnd()) return false;
+
+  if (count_ == 0) {
+    global_ = global;
+    inputs_ = inputs;
+    outputs_ = outputs;
+  } else {
+    global_.insert(global.begin(), global.end());
+    for (size_t index = 0; index < inputs.size(); ++index) {
+      inputs_[index].insert(inputs[index].begin(), inputs[index].end());
+    }
+    for (size_t index = 0; index < outputs.size(); ++index) {
+      outputs_[index].insert(outputs[index].begin(), outputs[index].end());
+    }
+  }
+  ++count_;
+  return true;
+}
+
+size_t PsbtRecordMerger::GetCount() const { return count_; }
+
+std::vector<uint8_t> PsbtRecordMerger::Serialize() const {
+  std::vector<uint8_t> result(std::begin(kPsbtMagic), std::end(kPsbtMagic));
+  WriteRecordMap(global_, &result);
+  for (const auto& input : inputs_) WriteRecordMap(input, &result);
+  for (const auto& output : outputs_) WriteRecordMap(output, &result);
+  return result;
+}
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
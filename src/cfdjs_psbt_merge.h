@@ -0,0 +1,69 @@
+// Copyright 2021 CryptoGarage
+/**
+ * @file cfdjs_psbt_merge.h
+ *
+ * @brief Definition of the N-way psbt record merger.
+ */
+#ifndef CFD_JS_SRC_CFDJS_PSBT_MERGE_H_
+#define CFD_JS_SRC_CFDJS_PSBT_MERGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace cfd {
+namespace js {
+namespace api {
+
+/**
+ * @brief Merger of psbt key-value records.
+ * @details Each psbt is scanned once into the key-indexed record maps of
+ *     the global, input and output sections. A duplicate key keeps the
+ *     record added first. Only version 0 psbts are supported.
+ */
+class PsbtRecordMerger {
+ public:
+  //! record map (key -> value)
+  using RecordMap = std::map<std::vector<uint8_t>, std::vector<uint8_t>>;
+
+  /**
+   * @brief constructor.
+   */
+  PsbtRecordMerger();
+
+  /**
+   * @brief Add a psbt.
+   * @details When false is returned, the merger state is not changed.
+   * @param[in] psbt    psbt binary
+   * @retval true   merged
+   * @retval false  invalid format, unsupported version, or the unsigned
+   *     transaction is different from the psbt added first.
+   */
+  bool Add(const std::vector<uint8_t>& psbt);
+
+  /**
+   * @brief Get the added psbt count.
+   * @return psbt count
+   */
+  size_t GetCount() const;
+
+  /**
+   * @brief Serialize the merged psbt.
+   * @details The records of each section are written in the key order.
+   * @return psbt binary
+   */
+  std::vector<uint8_t> Serialize() const;
+
+ private:
+  size_t count_;                     //!< added psbt count
+  RecordMap global_;                 //!< global records
+  std::vector<RecordMap> inputs_;    //!< input records
+  std::vector<RecordMap> outputs_;   //!< output records
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_SRC_CFDJS_PSBT_MERGE_H_
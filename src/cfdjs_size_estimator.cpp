@@ -0,0 +1,385 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_size_estimator.cpp
+ *
+ * @brief Implementation of the closed-form transaction size estimator.
+ */
+#include "cfdjs_size_estimator.h"  // NOLINT
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+#include "cfdjs_internal.h"  // NOLINT
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::core::CfdError;
+using cfd::core::CfdException;
+using cfd::core::logger::warn;
+
+//! outpoint(36) + sequence(4)
+static constexpr uint32_t kTxInBaseSize = 40;
+//! DER signature (low-R) + sighash type
+static constexpr uint32_t kEcdsaSignatureSize = 72;
+//! schnorr signature (default sighash type)
+static constexpr uint32_t kSchnorrSignatureSize = 64;
+//! compressed pubkey
+static constexpr uint32_t kPubkeySize = 33;
+//! tapscript control block base (leaf version + internal pubkey)
+static constexpr uint32_t kControlBlockBaseSize = 33;
+//! tapscript control block path node
+static constexpr uint32_t kControlBlockNodeSize = 32;
+//! elements commitment (asset, value, nonce)
+static constexpr uint32_t kCommitmentSize = 33;
+//! elements explicit value
+static constexpr uint32_t kExplicitValueSize = 9;
+//! bitcoin txout value
+static constexpr uint32_t kTxOutValueSize = 8;
+
+/**
+ * @brief Get the push size of a small number.
+ * @param[in] value   number
+ * @return push size
+ */
+static uint32_t GetNumberPushSize(uint32_t value) {
+  return (value <= 16) ? 1 : 2;
+}
+
+/**
+ * @brief Get the push size of data.
+ * @param[in] size    data size
+ * @return push size (including the data)
+ */
+static uint32_t GetDataPushSize(uint32_t size) {
+  if (size < 76) return size + 1;
+  if (size <= 0xff) return size + 2;
+  return size + 3;
+}
+
+/**
+ * @brief Get the multisig script size.
+ * @param[in] require_num   require signature num
+ * @param[in] pubkey_num    pubkey num
+ * @return script size
+ */
+static uint32_t GetMultisigScriptSize(
+    uint32_t require_num, uint32_t pubkey_num) {
+  return GetNumberPushSize(require_num) +
+         (pubkey_num * GetDataPushSize(kPubkeySize)) +
+         GetNumberPushSize(pubkey_num) + 1;
+}
+
+/**
+ * @brief Read the multisig parameters from a descriptor.
+ * @param[in] descriptor    descriptor string
+ * @param[in] offset        offset of 'multi(' or 'sortedmulti('
+ * @param[out] input        txin shape
+ */
+static void ReadMultisigDescriptor(
+    const std::string& descriptor, size_t offset,
+    EstimateSizeInputDataStruct* input) {
+  size_t start = descriptor.find('(', offset) + 1;
+  size_t end = descriptor.find(')', start);
+  if (end == std::string::npos) end = descriptor.size();
+  uint32_t comma_count = 0;
+  for (size_t index = start; index < end; ++index) {
+    if (descriptor[index] == ',') ++comma_count;
+  }
+  input->require_num = static_cast<uint32_t>(
+      std::strtoul(descriptor.substr(start).c_str(), nullptr, 10));
+  input->pubkey_num = comma_count;
+  input->redeem_script_size = 0;
+}
+
+/**
+ * @brief Apply the descriptor to the txin shape.
+ * @param[in,out] input   txin shape
+ * @retval true   applied
+ * @retval false  unsupported descriptor (addr, raw, combo, etc)
+ */
+static bool TryApplyDescriptor(EstimateSizeInputDataStruct* input) {
+  std::string desc = input->descriptor;
+  size_t checksum = desc.find('#');
+  if (checksum != std::string::npos) desc = desc.substr(0, checksum);
+
+  static const char* const kMultiList[] = {"multi(", "sortedmulti("};
+  auto find_multi = [&desc](size_t offset) -> bool {
+    for (const char* multi : kMultiList) {
+      if (desc.compare(offset, std::string(multi).size(), multi) == 0) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  if (desc.compare(0, 8, "sh(wpkh(") == 0) {
+    input->type = "p2sh-p2wpkh";
+  } else if (desc.compare(0, 7, "sh(wsh(") == 0) {
+    input->type = "p2sh-p2wsh";
+    if (find_multi(7)) ReadMultisigDescriptor(desc, 7, input);
+  } else if (desc.compare(0, 3, "sh(") == 0) {
+    input->type = "p2sh";
+    if (find_multi(3)) ReadMultisigDescriptor(desc, 3, input);
+  } else if (desc.compare(0, 4, "wsh(") == 0) {
+    input->type = "p2wsh";
+    if (find_multi(4)) ReadMultisigDescriptor(desc, 4, input);
+  } else if (desc.compare(0, 5, "wpkh(") == 0) {
+    input->type = "p2wpkh";
+  } else if (desc.compare(0, 4, "pkh(") == 0) {
+    input->type = "p2pkh";
+  } else if (desc.compare(0, 3, "tr(") == 0) {
+    input->type = "taproot";
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Apply the descriptor to the txin shape.
+ * @param[in,out] input   txin shape
+ * @throw CfdException  unsupported descriptor
+ */
+static void ApplyDescriptor(EstimateSizeInputDataStruct* input) {
+  if (!TryApplyDescriptor(input)) {
+    warn(
+        CFD_LOG_SOURCE, "Failed to EstimateTransactionSize. descriptor={}",
+        input->descriptor);
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Unsupported descriptor. descriptor=" + input->descriptor);
+  }
+}
+
+int64_t TxSizeEstimator::EstimateWeight(
+    const EstimateTransactionSizeCandidateStruct& candidate,
+    bool is_elements, int exponent, int minimum_bits) {
+  uint64_t txin_count = 0;
+  uint64_t txout_count = 0;
+  uint64_t no_witness_size = 0;
+  uint64_t witness_size = 0;
+  uint64_t empty_witness_count = 0;
+  bool has_witness = false;
+
+  for (const auto& input : candidate.inputs) {
+    TxSizeData size = GetTxInSize(input);
+    txin_count += input.count;
+    no_witness_size += static_cast<uint64_t>(size.no_witness_size) *
+                       input.count;
+    if (size.witness_size == 0) {
+      empty_witness_count += input.count;
+    } else {
+      witness_size += static_cast<uint64_t>(size.witness_size) * input.count;
+      has_witness = true;
+    }
+  }
+  if (is_elements) {
+    // issuance amount rangeproof, inflation keys rangeproof, pegin witness
+    witness_size += txin_count * 3;
+  }
+
+  uint64_t surjection_input_count = candidate.surjection_input_count;
+  if (surjection_input_count == 0) surjection_input_count = txin_count;
+  uint32_t surjection_size = GetSurjectionProofSize(
+      static_cast<uint32_t>(std::max<uint64_t>(surjection_input_count, 1)));
+  for (const auto& output : candidate.outputs) {
+    uint32_t script_size = GetLockingScriptSize(output);
+    uint64_t size = GetVarIntSize(script_size) + script_size;
+    uint64_t wit_size = 0;
+    if (!is_elements) {
+      size += kTxOutValueSize;
+    } else if (output.is_blind && (output.type != "fee")) {
+      size += kCommitmentSize * 3;
+      uint32_t rangeproof_size =
+          GetRangeProofSize(output.amount, exponent, minimum_bits);
+      wit_size = GetBlindProofWitnessSize(rangeproof_size, surjection_size);
+      has_witness = true;
+    } else {
+      size += kCommitmentSize + kExplicitValueSize + 1;
+      wit_size = 2;  // empty surjection proof & rangeproof
+    }
+    txout_count += output.count;
+    no_witness_size += size * output.count;
+    witness_size += wit_size * output.count;
+  }
+
+  // version + locktime
+  no_witness_size += 8 + GetVarIntSize(txin_count) + GetVarIntSize(txout_count);
+  if (is_elements) {
+    no_witness_size += 1;  // witness flag
+    witness_size += empty_witness_count;
+  } else if (has_witness) {
+    witness_size += 2 + empty_witness_count;  // marker & flag
+  }
+  if (!has_witness) witness_size = 0;
+  return static_cast<int64_t>((no_witness_size * 4) + witness_size);
+}
+
+TxSizeData TxSizeEstimator::GetTxInSize(
+    const EstimateSizeInputDataStruct& input) {
+  EstimateSizeInputDataStruct data = input;
+  if (!data.descriptor.empty()) ApplyDescriptor(&data);
+
+  const std::string& type = data.type;
+  uint32_t require_num = data.require_num;
+  uint32_t script_size = data.redeem_script_size;
+  TxSizeData result;
+  // witness stack of pubkey-hash (count, signature, pubkey)
+  uint32_t pkh_witness = 1 + GetDataPushSize(kEcdsaSignatureSize) +
+                         GetDataPushSize(kPubkeySize);
+  if (type == "p2pkh") {
+    uint32_t script_sig = GetDataPushSize(kEcdsaSignatureSize) +
+                          GetDataPushSize(kPubkeySize);
+    result.no_witness_size =
+        kTxInBaseSize + GetVarIntSize(script_sig) + script_sig;
+  } else if (type == "p2wpkh") {
+    result.no_witness_size = kTxInBaseSize + 1;
+    result.witness_size = pkh_witness;
+  } else if (type == "p2sh-p2wpkh") {
+    result.no_witness_size = kTxInBaseSize + 1 + GetDataPushSize(22);
+    result.witness_size = pkh_witness;
+  } else if (type == "p2sh") {
+    if (script_size == 0) {
+      script_size = GetMultisigScriptSize(require_num, data.pubkey_num);
+    }
+    uint32_t script_sig = 1 +
+                          (require_num *
+                           GetDataPushSize(kEcdsaSignatureSize)) +
+                          GetDataPushSize(script_size);
+    result.no_witness_size =
+        kTxInBaseSize + GetVarIntSize(script_sig) + script_sig;
+  } else if ((type == "p2wsh") || (type == "p2sh-p2wsh")) {
+    if (script_size == 0) {
+      script_size = GetMultisigScriptSize(require_num, data.pubkey_num);
+    }
+    result.no_witness_size = kTxInBaseSize + 1;
+    if (type == "p2sh-p2wsh") result.no_witness_size += GetDataPushSize(34);
+    // count, multisig dummy, signatures, witness script
+    result.witness_size = GetVarIntSize(require_num + 2) + 1 +
+                          (require_num * (kEcdsaSignatureSize + 1)) +
+                          GetVarIntSize(script_size) + script_size;
+  } else if (type == "taproot") {
+    result.no_witness_size = kTxInBaseSize + 1;
+    result.witness_size = 1 + 1 + kSchnorrSignatureSize;
+  } else if (type == "tapscript") {
+    uint32_t pubkey_num = std::max(data.pubkey_num, require_num);
+    if (script_size == 0) {
+      // <pubkey> OP_CHECKSIG(ADD) ... <require_num> OP_NUMEQUAL
+      script_size = (pubkey_num * (GetDataPushSize(kPubkeySize) + 1)) +
+                    GetNumberPushSize(require_num) + 1;
+    }
+    uint32_t control_block =
+        kControlBlockBaseSize + (data.tap_leaf_depth * kControlBlockNodeSize);
+    result.no_witness_size = kTxInBaseSize + 1;
+    // signatures (empty for unsigned keys), tapscript, control block
+    result.witness_size = GetVarIntSize(pubkey_num + 2) +
+                          (require_num * (kSchnorrSignatureSize + 1)) +
+                          (pubkey_num - require_num) +
+                          GetVarIntSize(script_size) + script_size +
+                          GetVarIntSize(control_block) + control_block;
+  } else {
+    warn(
+        CFD_LOG_SOURCE, "Failed to EstimateTransactionSize. type={}", type);
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Invalid input type. type=" + type);
+  }
+  return result;
+}
+
+TxSizeData TxSizeEstimator::GetUtxoTxInSize(
+    const std::string& descriptor, uint32_t scriptsig_template_size,
+    const std::string& default_type) {
+  EstimateSizeInputDataStruct input;
+  input.type = default_type;
+  bool has_type = false;
+  if (!descriptor.empty()) {
+    input.descriptor = descriptor;
+    has_type = TryApplyDescriptor(&input);
+    if (!has_type) input.type = default_type;
+  }
+  input.descriptor = "";
+  TxSizeData result = GetTxInSize(input);
+  if (scriptsig_template_size != 0) {
+    if (has_type && (result.witness_size != 0)) {
+      // the template is the witness stack of a segwit txin.
+      result.witness_size = 1 + scriptsig_template_size;
+    } else {
+      result.no_witness_size = kTxInBaseSize +
+                               GetVarIntSize(scriptsig_template_size) +
+                               scriptsig_template_size;
+      result.witness_size = 0;
+    }
+  }
+  return result;
+}
+
+uint32_t TxSizeEstimator::GetLockingScriptSize(
+    const EstimateSizeOutputDataStruct& output) {
+  const std::string& type = output.type;
+  if (type.empty()) {
+    return output.locking_script_size;
+  } else if (type == "p2pkh") {
+    return 25;
+  } else if (type == "p2sh") {
+    return 23;
+  } else if (type == "p2wpkh") {
+    return 22;
+  } else if ((type == "p2wsh") || (type == "taproot")) {
+    return 34;
+  } else if (type == "fee") {
+    return 0;
+  }
+  warn(CFD_LOG_SOURCE, "Failed to EstimateTransactionSize. type={}", type);
+  throw CfdException(
+      CfdError::kCfdIllegalArgumentError, "Invalid output type. type=" + type);
+}
+
+uint32_t TxSizeEstimator::GetRangeProofSize(
+    int64_t amount, int exponent, int minimum_bits) {
+  int64_t value = (amount > 0) ? amount : 0;
+  for (int index = 0; index < exponent; ++index) value /= 10;
+  uint32_t value_bits = 1;
+  while ((value_bits < 64) && ((value >> value_bits) != 0)) ++value_bits;
+
+  uint32_t mantissa = (minimum_bits > 0) ? minimum_bits : 1;
+  if (mantissa > 64) mantissa = 64;
+  if (value_bits > mantissa) mantissa = value_bits;
+  uint32_t rings = (mantissa + 1) / 2;
+  uint32_t pubkey_num = (rings * 4) - (2 * (mantissa % 2));
+  return 10 + (32 * (pubkey_num + rings - 1)) + 32 + ((rings - 1 + 7) / 8);
+}
+
+uint32_t TxSizeEstimator::GetSurjectionProofSize(uint32_t input_count) {
+  // elements uses up to 3 inputs for the surjection ring
+  uint32_t used_count = std::min<uint32_t>(input_count, 3);
+  return 2 + ((input_count + 7) / 8) + (32 * (1 + used_count));
+}
+
+uint32_t TxSizeEstimator::GetBlindProofWitnessSize(
+    uint32_t rangeproof_size, uint32_t surjection_size) {
+  return GetVarIntSize(surjection_size) + surjection_size +
+         GetVarIntSize(rangeproof_size) + rangeproof_size;
+}
+
+uint32_t TxSizeEstimator::GetBlindTxOutWeight(
+    uint32_t rangeproof_size, uint32_t surjection_size) {
+  // empty surjection proof & rangeproof are 1 byte each.
+  uint32_t witness_size =
+      GetBlindProofWitnessSize(rangeproof_size, surjection_size) - 2;
+  return ((kCommitmentSize - kExplicitValueSize) * 4) + witness_size;
+}
+
+uint32_t TxSizeEstimator::GetVarIntSize(uint64_t value) {
+  if (value < 0xfd) return 1;
+  if (value <= 0xffff) return 3;
+  if (value <= 0xffffffff) return 5;
+  return 9;
+}
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
@@ -0,0 +1,130 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_size_estimator.h
+ *
+ * @brief Definition of the closed-form transaction size estimator.
+ */
+#ifndef CFD_JS_SRC_CFDJS_SIZE_ESTIMATOR_H_
+#define CFD_JS_SRC_CFDJS_SIZE_ESTIMATOR_H_
+
+#include <cstdint>
+#include <string>
+
+#include "cfdjs/cfdjs_struct.h"
+
+namespace cfd {
+namespace js {
+namespace api {
+
+/**
+ * @brief Serialized size of a txin (or txout), split by area.
+ */
+struct TxSizeData {
+  uint32_t no_witness_size = 0;  //!< non-witness area size
+  uint32_t witness_size = 0;     //!< witness area size (0: no witness)
+};
+
+/**
+ * @brief Closed-form transaction size estimator.
+ * @details Sizes are taken from weight tables per script type, so no dummy
+ *     signature or unlocking script is constructed.
+ */
+class TxSizeEstimator {
+ public:
+  /**
+   * @brief Estimate the transaction weight.
+   * @param[in] candidate     candidate transaction shape
+   * @param[in] is_elements   elements transaction flag
+   * @param[in] exponent      blind exponent (elements only)
+   * @param[in] minimum_bits  blind minimum bits (elements only)
+   * @return transaction weight
+   */
+  static int64_t EstimateWeight(
+      const EstimateTransactionSizeCandidateStruct& candidate,
+      bool is_elements, int exponent, int minimum_bits);
+
+  /**
+   * @brief Get the txin size.
+   * @param[in] input   txin shape
+   * @return txin size (excluding elements specific witness fields)
+   */
+  static TxSizeData GetTxInSize(const EstimateSizeInputDataStruct& input);
+
+  /**
+   * @brief Get the txin size of a utxo.
+   * @details The size is taken from the descriptor, then the scriptSig
+   *     template, then the default type. A descriptor that has no script
+   *     type (addr, raw, combo) falls back to the default type.
+   * @param[in] descriptor                utxo descriptor (empty: none)
+   * @param[in] scriptsig_template_size   scriptSig template size (0: none)
+   * @param[in] default_type              default txin type
+   * @return txin size (excluding elements specific witness fields)
+   */
+  static TxSizeData GetUtxoTxInSize(
+      const std::string& descriptor, uint32_t scriptsig_template_size,
+      const std::string& default_type);
+
+  /**
+   * @brief Get the locking script size of the output.
+   * @param[in] output  txout shape
+   * @return locking script size
+   */
+  static uint32_t GetLockingScriptSize(
+      const EstimateSizeOutputDataStruct& output);
+
+  /**
+   * @brief Get the upper bound of the rangeproof size.
+   * @details Same as secp256k1_rangeproof_max_size.
+   * @param[in] amount        satoshi amount (0: fit in minimum_bits)
+   * @param[in] exponent      blind exponent
+   * @param[in] minimum_bits  blind minimum bits
+   * @return rangeproof size
+   */
+  static uint32_t GetRangeProofSize(
+      int64_t amount, int exponent, int minimum_bits);
+
+  /**
+   * @brief Get the surjection proof size.
+   * @details Same as secp256k1_surjectionproof_serialized_size.
+   * @param[in] input_count   surjection input (asset) count
+   * @return surjection proof size
+   */
+  static uint32_t GetSurjectionProofSize(uint32_t input_count);
+
+  /**
+   * @brief Get the witness size of the blinded txout proofs.
+   * @param[in] rangeproof_size   rangeproof size
+   * @param[in] surjection_size   surjection proof size
+   * @return witness size (including the size prefixes)
+   */
+  static uint32_t GetBlindProofWitnessSize(
+      uint32_t rangeproof_size, uint32_t surjection_size);
+
+  /**
+   * @brief Get the weight added by blinding a txout.
+   * @details The explicit value is replaced by the value commitment, and the
+   *     empty proofs are replaced by the rangeproof and the surjection proof.
+   *     The nonce is assumed to be set already (confidential address).
+   * @param[in] rangeproof_size   rangeproof size
+   * @param[in] surjection_size   surjection proof size
+   * @return added weight
+   */
+  static uint32_t GetBlindTxOutWeight(
+      uint32_t rangeproof_size, uint32_t surjection_size);
+
+  /**
+   * @brief Get the variable integer size.
+   * @param[in] value   value
+   * @return serialized size
+   */
+  static uint32_t GetVarIntSize(uint64_t value);
+
+ private:
+  TxSizeEstimator();
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_SRC_CFDJS_SIZE_ESTIMATOR_H_
@@ -0,0 +1,213 @@
+// Copyright 2021 CryptoGarage
+/**
+ * @file cfdjs_slip77.cpp
+ *
+ * @brief Implementation of the SLIP77 blinding key derivation.
+ */
+#include "cfdjs_slip77.h"  // NOLINT
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "cfdcore/cfdcore_bytedata.h"
+#include "cfdcore/cfdcore_exception.h"
+#include "cfdcore/cfdcore_logger.h"
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::core::ByteData256;
+using cfd::core::CfdError;
+using cfd::core::CfdException;
+using cfd::core::logger::warn;
+
+namespace {
+
+//! sha256 block size
+constexpr size_t kSha256BlockSize = 64;
+
+//! sha256 round constants
+constexpr uint32_t kSha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+//! sha256 initial state
+constexpr uint32_t kSha256InitialState[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+/**
+ * @brief Rotate right.
+ * @param[in] value   value
+ * @param[in] count   rotate bit count
+ * @return rotated value
+ */
+inline uint32_t RotateRight(uint32_t value, uint32_t count) {
+  return (value >> count) | (value << (32 - count));
+}
+
+/**
+ * @brief Process a sha256 block.
+ * @param[in,out] state   sha256 state
+ * @param[in] block       64 byte block
+ */
+void Sha256Transform(uint32_t* state, const uint8_t* block) {
+  uint32_t w[64];
+  for (size_t index = 0; index < 16; ++index) {
+    w[index] = (static_cast<uint32_t>(block[index * 4]) << 24) |
+               (static_cast<uint32_t>(block[index * 4 + 1]) << 16) |
+               (static_cast<uint32_t>(block[index * 4 + 2]) << 8) |
+               static_cast<uint32_t>(block[index * 4 + 3]);
+  }
+  for (size_t index = 16; index < 64; ++index) {
+    uint32_t s0 = RotateRight(w[index - 15], 7) ^
+                  RotateRight(w[index - 15], 18) ^ (w[index - 15] >> 3);
+    uint32_t s1 = RotateRight(w[index - 2], 17) ^
+                  RotateRight(w[index - 2], 19) ^ (w[index - 2] >> 10);
+    w[index] = w[index - 16] + s0 + w[index - 7] + s1;
+  }
+
+  uint32_t a = state[0];
+  uint32_t b = state[1];
+  uint32_t c = state[2];
+  uint32_t d = state[3];
+  uint32_t e = state[4];
+  uint32_t f = state[5];
+  uint32_t g = state[6];
+  uint32_t h = state[7];
+  for (size_t index = 0; index < 64; ++index) {
+    uint32_t s1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+    uint32_t ch = (e & f) ^ (~e & g);
+    uint32_t temp1 = h + s1 + ch + kSha256K[index] + w[index];
+    uint32_t s0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+    uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+    uint32_t temp2 = s0 + maj;
+    h = g;
+    g = f;
+    f = e;
+    e = d + temp1;
+    d = c;
+    c = b;
+    b = a;
+    a = temp1 + temp2;
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+  state[5] += f;
+  state[6] += g;
+  state[7] += h;
+}
+
+/**
+ * @brief Hash the rest of the message from a sha256 midstate.
+ * @param[in] midstate      sha256 state after the prefix blocks
+ * @param[in] prefix_size   processed prefix size (multiple of 64)
+ * @param[in] data          rest of the message
+ * @param[in] size          rest size
+ * @param[out] digest       32 byte digest
+ */
+void Sha256Finalize(
+    const uint32_t* midstate, uint64_t prefix_size, const uint8_t* data,
+    size_t size, uint8_t* digest) {
+  uint32_t state[8];
+  memcpy(state, midstate, sizeof(state));
+  size_t offset = 0;
+  for (; offset + kSha256BlockSize <= size; offset += kSha256BlockSize) {
+    Sha256Transform(state, data + offset);
+  }
+
+  uint8_t block[kSha256BlockSize * 2] = {};
+  size_t rest = size - offset;
+  if (rest != 0) memcpy(block, data + offset, rest);
+  block[rest] = 0x80;
+  size_t block_size =
+      (rest + 9 <= kSha256BlockSize) ? kSha256BlockSize : kSha256BlockSize * 2;
+  uint64_t bit_size = (prefix_size + size) * 8;
+  for (size_t index = 0; index < 8; ++index) {
+    block[block_size - 1 - index] =
+        static_cast<uint8_t>(bit_size >> (index * 8));
+  }
+  Sha256Transform(state, block);
+  if (block_size > kSha256BlockSize) {
+    Sha256Transform(state, block + kSha256BlockSize);
+  }
+
+  for (size_t index = 0; index < 8; ++index) {
+    digest[index * 4] = static_cast<uint8_t>(state[index] >> 24);
+    digest[index * 4 + 1] = static_cast<uint8_t>(state[index] >> 16);
+    digest[index * 4 + 2] = static_cast<uint8_t>(state[index] >> 8);
+    digest[index * 4 + 3] = static_cast<uint8_t>(state[index]);
+  }
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Slip77KeyDeriver
+// -----------------------------------------------------------------------------
+Slip77KeyDeriver::Slip77KeyDeriver(
+    const Privkey& master_blinding_key, bool use_cache)
+    : use_cache_(use_cache) {
+  std::vector<uint8_t> key_bytes = master_blinding_key.GetData().GetBytes();
+
+  // HMAC key shorter than the block size is zero padded.
+  uint8_t inner_pad[kSha256BlockSize];
+  uint8_t outer_pad[kSha256BlockSize];
+  memset(inner_pad, 0x36, sizeof(inner_pad));
+  memset(outer_pad, 0x5c, sizeof(outer_pad));
+  for (size_t index = 0; index < key_bytes.size(); ++index) {
+    inner_pad[index] ^= key_bytes[index];
+    outer_pad[index] ^= key_bytes[index];
+  }
+  memcpy(inner_state_, kSha256InitialState, sizeof(inner_state_));
+  memcpy(outer_state_, kSha256InitialState, sizeof(outer_state_));
+  Sha256Transform(inner_state_, inner_pad);
+  Sha256Transform(outer_state_, outer_pad);
+}
+
+Privkey Slip77KeyDeriver::GetBlindingKey(const Script& locking_script) {
+  if (locking_script.IsEmpty()) {
+    warn(CFD_LOG_SOURCE, "Failed to GetBlindingKey. locking script is empty.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to GetBlindingKey. locking script is empty.");
+  }
+  std::vector<uint8_t> script_bytes = locking_script.GetData().GetBytes();
+  std::string cache_key;
+  if (use_cache_) {
+    cache_key.assign(script_bytes.begin(), script_bytes.end());
+    auto ite = cache_.find(cache_key);
+    if (ite != cache_.end()) return ite->second;
+  }
+
+  uint8_t inner_digest[32];
+  std::vector<uint8_t> digest(32);
+  Sha256Finalize(
+      inner_state_, kSha256BlockSize, script_bytes.data(), script_bytes.size(),
+      inner_digest);
+  Sha256Finalize(
+      outer_state_, kSha256BlockSize, inner_digest, sizeof(inner_digest),
+      digest.data());
+  Privkey blinding_key(ByteData256(digest));
+
+  if (use_cache_) cache_.emplace(cache_key, blinding_key);
+  return blinding_key;
+}
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
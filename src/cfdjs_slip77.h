@@ -0,0 +1,60 @@
+// Copyright 2021 CryptoGarage
+/**
+ * @file cfdjs_slip77.h
+ *
+ * @brief Definition of the SLIP77 blinding key derivation.
+ */
+#ifndef CFD_JS_SRC_CFDJS_SLIP77_H_
+#define CFD_JS_SRC_CFDJS_SLIP77_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "cfdcore/cfdcore_key.h"
+#include "cfdcore/cfdcore_script.h"
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::core::Privkey;
+using cfd::core::Script;
+
+/**
+ * @brief SLIP77 blinding key deriver of a master blinding key.
+ * @details The HMAC-SHA256 inner and outer pad blocks of the master key are
+ *     hashed once in the constructor, so each derivation only hashes the
+ *     locking script and the inner digest. The cache of derived keys lives
+ *     as long as the deriver, so it is not thread-safe.
+ */
+class Slip77KeyDeriver {
+ public:
+  /**
+   * @brief constructor.
+   * @param[in] master_blinding_key   master blinding key
+   * @param[in] use_cache             reuse the key of the same locking script
+   */
+  explicit Slip77KeyDeriver(
+      const Privkey& master_blinding_key, bool use_cache = false);
+
+  /**
+   * @brief Derive the blinding key of the locking script.
+   * @param[in] locking_script    locking script
+   * @return blinding key
+   */
+  Privkey GetBlindingKey(const Script& locking_script);
+
+ private:
+  uint32_t inner_state_[8];  //!< sha256 state after the inner pad block
+  uint32_t outer_state_[8];  //!< sha256 state after the outer pad block
+  bool use_cache_;           //!< cache flag
+  //! derived key cache (key: locking script bytes)
+  std::unordered_map<std::string, Privkey> cache_;
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_SRC_CFDJS_SLIP77_H_
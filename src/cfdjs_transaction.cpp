@@ -7,6 +7,9 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <memory>
+#include <mutex>  // NOLINT
 #include <string>
 #include <vector>
 
@@ -21,10 +24,13 @@
 #include "cfdcore/cfdcore_taproot.h"
 #include "cfdjs/cfdjs_api_address.h"
 #include "cfdjs/cfdjs_api_transaction.h"
-#include "cfdjs_address_base.h"      // NOLINT
-#include "cfdjs_internal.h"          // NOLINT
-#include "cfdjs_json_transaction.h"  // NOLINT
-#include "cfdjs_transaction_base.h"  // NOLINT
+#include "cfdjs_address_base.h"          // NOLINT
+#include "cfdjs_internal.h"              // NOLINT
+#include "cfdjs_json_transaction.h"      // NOLINT
+#include "cfdjs_locking_script_cache.h"  // NOLINT
+#include "cfdjs_size_estimator.h"        // NOLINT
+#include "cfdjs_transaction_base.h"      // NOLINT
+#include "cfdjs_utxo_pool.h"             // NOLINT
 
 namespace cfd {
 namespace js {
@@ -70,6 +76,106 @@ using cfd::js::api::AddressStructApi;
 using cfd::js::api::TransactionStructApi;
 using cfd::js::api::TransactionStructApiBase;
 
+/**
+ * @brief Update the txout amounts.
+ * @param[in] txouts            update target txout list
+ * @param[in] address_factory   address factory
+ * @param[in,out] ctx           transaction context
+ */
+static void UpdateTxOutAmounts(
+    const std::vector<UpdateTxOutAmountDataStruct>& txouts,
+    const AddressFactory& address_factory, TransactionContext* ctx) {
+  for (const auto& txout : txouts) {
+    uint32_t index = txout.index;
+    if (!txout.direct_locking_script.empty()) {
+      index = ctx->GetTxOutIndex(Script(txout.direct_locking_script));
+    } else if (!txout.address.empty()) {
+      index = ctx->GetTxOutIndex(address_factory.GetAddress(txout.address));
+    }
+    ctx->SetTxOutValue(index, Amount(txout.amount));
+  }
+}
+
+/**
+ * @brief Split the txout.
+ * @param[in] index             split target txout index
+ * @param[in] txouts            split txout list
+ * @param[in] address_factory   address factory
+ * @param[in,out] ctx           transaction context
+ */
+static void SplitTxOutByData(
+    uint32_t index, const std::vector<SplitTxOutDataStruct>& txouts,
+    const AddressFactory& address_factory, TransactionContext* ctx) {
+  std::vector<Amount> amounts;
+  std::vector<Script> scripts;
+  for (const auto& txout : txouts) {
+    amounts.emplace_back(txout.amount);
+    if (!txout.direct_locking_script.empty()) {
+      scripts.emplace_back(Script(txout.direct_locking_script));
+    } else {
+      scripts.emplace_back(
+          address_factory.GetAddress(txout.address).GetLockingScript());
+    }
+  }
+  ctx->SplitTxOut(index, amounts, scripts);
+}
+
+/**
+ * @brief Create the signature hash of the txin.
+ * @param[in] txin      sighash target txin
+ * @param[in,out] tx    transaction context (utxos collected)
+ * @return signature hash hex
+ */
+static std::string CreateTxInSighash(
+    const GetSighashTxInStruct& txin, TransactionContext* tx) {
+  AddressType addr_type = AddressApiBase::ConvertAddressType(txin.hash_type);
+  OutPoint outpoint(Txid(txin.txid), txin.vout);
+  bool has_taproot = (addr_type == AddressType::kTaprootAddress);
+  SigHashType sighashtype = TransactionStructApiBase::ConvertSigHashType(
+      txin.sighash_type, txin.sighash_anyone_can_pay, txin.sighash_rangeproof,
+      has_taproot);
+
+  Script redeem_script;
+  bool is_pubkey = false;
+  if (txin.key_data.type == "pubkey") {
+    is_pubkey = true;
+  } else if (txin.key_data.type == "redeem_script") {
+    redeem_script = Script(txin.key_data.hex);
+  }
+
+  if (has_taproot) {
+    ByteData annex(txin.annex);
+    uint32_t pos = static_cast<uint32_t>(txin.code_separator_position);
+    ByteData256 tapleaf_hash;
+    if (!is_pubkey) {
+      TaprootScriptTree tree(redeem_script);
+      tapleaf_hash = tree.GetTapLeafHash();
+    }
+    auto sighash = tx->CreateSignatureHashByTaproot(
+        outpoint, sighashtype, (is_pubkey) ? nullptr : &tapleaf_hash,
+        (txin.code_separator_position < 0) ? nullptr : &pos,
+        (annex.IsEmpty()) ? nullptr : &annex);
+    return sighash.GetHex();
+  }
+
+  WitnessVersion version = WitnessVersion::kVersion0;
+  if ((addr_type == AddressType::kP2pkhAddress) ||
+      (addr_type == AddressType::kP2shAddress)) {
+    version = WitnessVersion::kVersionNone;
+  }
+  auto utxo = tx->GetTxInUtxoData(outpoint);
+  ByteData sighash;
+  if (is_pubkey) {
+    Pubkey pubkey(txin.key_data.hex);
+    sighash = tx->CreateSignatureHash(
+        outpoint, pubkey, sighashtype, utxo.amount, version);
+  } else {
+    sighash = tx->CreateSignatureHash(
+        outpoint, redeem_script, sighashtype, utxo.amount, version);
+  }
+  return sighash.GetHex();
+}
+
 // -----------------------------------------------------------------------------
 // TransactionStructApiクラス
 // -----------------------------------------------------------------------------
@@ -183,7 +289,6 @@ DecodeRawTransactionResponseStruct TransactionStructApi::DecodeRawTransaction(
     response.version = tx.GetVersion();
     response.locktime = tx.GetLockTime();
 
-    AddressFactory factory(net_type);
     for (auto& tx_in_ref : tx.GetTxInList()) {
       DecodeRawTransactionTxInStruct res_txin;
       if (tx.IsCoinBase()) {
@@ -201,7 +306,10 @@ DecodeRawTransactionResponseStruct TransactionStructApi::DecodeRawTransaction(
         res_txin.txid = tx_in_ref.GetTxid().GetHex();
         res_txin.vout = tx_in_ref.GetVout();
         if (!tx_in_ref.GetUnlockingScript().IsEmpty()) {
-          res_txin.script_sig.asm_ = tx_in_ref.GetUnlockingScript().ToString();
+          if (!request.skip_asm) {
+            res_txin.script_sig.asm_ =
+                tx_in_ref.GetUnlockingScript().ToString();
+          }
           res_txin.script_sig.hex = tx_in_ref.GetUnlockingScript().GetHex();
         }
         for (const ByteData& witness :
@@ -228,7 +336,9 @@ DecodeRawTransactionResponseStruct TransactionStructApi::DecodeRawTransaction(
       std::vector<ScriptElement> script_element =
           locking_script.GetElementList();
       res_txout.script_pub_key.hex = locking_script.GetHex();
-      res_txout.script_pub_key.asm_ = locking_script.ToString();
+      if (!request.skip_asm) {
+        res_txout.script_pub_key.asm_ = locking_script.ToString();
+      }
 
       if (locking_script.IsEmpty()) {
         res_txout.script_pub_key.type = "nonstandard";
@@ -237,7 +347,7 @@ DecodeRawTransactionResponseStruct TransactionStructApi::DecodeRawTransaction(
       } else {
         int64_t require_num = 0;
         auto addr_list = ConvertFromLockingScript(
-            factory, locking_script, &res_txout.script_pub_key.type,
+            net_type, locking_script, &res_txout.script_pub_key.type,
             &require_num);
         if (require_num == 0) {
           res_txout.script_pub_key.ignore_items.insert("reqSigs");
@@ -613,57 +723,7 @@ CreateSignatureHashResponseStruct TransactionStructApi::GetSighash(
     auto utxo_list =
         TransactionStructApiBase::ConvertUtxoList(request.utxos, &factory);
     tx.CollectInputUtxo(utxo_list);
-
-    AddressType addr_type =
-        AddressApiBase::ConvertAddressType(request.txin.hash_type);
-    OutPoint outpoint(Txid(request.txin.txid), request.txin.vout);
-    bool has_taproot = (addr_type == AddressType::kTaprootAddress);
-    SigHashType sighashtype = TransactionStructApiBase::ConvertSigHashType(
-        request.txin.sighash_type, request.txin.sighash_anyone_can_pay,
-        request.txin.sighash_rangeproof, has_taproot);
-
-    Script redeem_script;
-    bool is_pubkey = false;
-    if (request.txin.key_data.type == "pubkey") {
-      is_pubkey = true;
-    } else if (request.txin.key_data.type == "redeem_script") {
-      redeem_script = Script(request.txin.key_data.hex);
-    }
-
-    if (has_taproot) {
-      SchnorrPubkey pubkey;
-      if (is_pubkey) pubkey = SchnorrPubkey(request.txin.key_data.hex);
-      ByteData annex(request.txin.annex);
-      uint32_t pos =
-          static_cast<uint32_t>(request.txin.code_separator_position);
-      ByteData256 tapleaf_hash;
-      if (!is_pubkey) {
-        TaprootScriptTree tree(redeem_script);
-        tapleaf_hash = tree.GetTapLeafHash();
-      }
-      auto sighash = tx.CreateSignatureHashByTaproot(
-          outpoint, sighashtype, (is_pubkey) ? nullptr : &tapleaf_hash,
-          (request.txin.code_separator_position < 0) ? nullptr : &pos,
-          (annex.IsEmpty()) ? nullptr : &annex);
-      response.sighash = sighash.GetHex();
-    } else {
-      WitnessVersion version = WitnessVersion::kVersion0;
-      if ((addr_type == AddressType::kP2pkhAddress) ||
-          (addr_type == AddressType::kP2shAddress)) {
-        version = WitnessVersion::kVersionNone;
-      }
-      auto utxo = tx.GetTxInUtxoData(outpoint);
-      ByteData sighash;
-      if (is_pubkey) {
-        Pubkey pubkey(request.txin.key_data.hex);
-        sighash = tx.CreateSignatureHash(
-            outpoint, pubkey, sighashtype, utxo.amount, version);
-      } else {
-        sighash = tx.CreateSignatureHash(
-            outpoint, redeem_script, sighashtype, utxo.amount, version);
-      }
-      response.sighash = sighash.GetHex();
-    }
+    response.sighash = CreateTxInSighash(request.txin, &tx);
     return response;
   };
 
@@ -674,6 +734,38 @@ CreateSignatureHashResponseStruct TransactionStructApi::GetSighash(
   return result;
 }
 
+GetSighashesResponseStruct TransactionStructApi::GetSighashes(
+    const GetSighashesRequestStruct& request) {
+  auto call_func = [](const GetSighashesRequestStruct& request)
+      -> GetSighashesResponseStruct {  // NOLINT
+    GetSighashesResponseStruct response;
+    TransactionContext tx(request.tx);
+    AddressFactory factory;
+    auto utxo_list =
+        TransactionStructApiBase::ConvertUtxoList(request.utxos, &factory);
+    tx.CollectInputUtxo(utxo_list);
+
+    // Each sighash is computed independently by cfd. The shared BIP143
+    // and BIP341 hashes (hashPrevouts etc.) are not reused across txins;
+    // only the parsed transaction and the utxo lookup are shared.
+    response.sighashes.reserve(request.txins.size());
+    for (const auto& txin : request.txins) {
+      SighashDataStruct data;
+      data.txid = txin.txid;
+      data.vout = txin.vout;
+      data.sighash = CreateTxInSighash(txin, &tx);
+      response.sighashes.push_back(data);
+    }
+    return response;
+  };
+
+  GetSighashesResponseStruct result;
+  result =
+      ExecuteStructApi<GetSighashesRequestStruct, GetSighashesResponseStruct>(
+          request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 RawTransactionResponseStruct TransactionStructApi::AddTaprootSchnorrSign(
     const AddTaprootSchnorrSignRequestStruct& request) {
   auto call_func = [](const AddTaprootSchnorrSignRequestStruct& request)
@@ -889,15 +981,7 @@ RawTransactionResponseStruct TransactionStructApi::UpdateTxOutAmount(
 
     TransactionContext ctx(request.tx);
     AddressFactory address_factory;
-    for (auto& txout : request.txouts) {
-      uint32_t index = txout.index;
-      if (!txout.direct_locking_script.empty()) {
-        index = ctx.GetTxOutIndex(Script(txout.direct_locking_script));
-      } else if (!txout.address.empty()) {
-        index = ctx.GetTxOutIndex(address_factory.GetAddress(txout.address));
-      }
-      ctx.SetTxOutValue(index, Amount(txout.amount));
-    }
+    UpdateTxOutAmounts(request.txouts, address_factory, &ctx);
 
     response.hex = ctx.GetHex();
     return response;
@@ -917,19 +1001,8 @@ RawTransactionResponseStruct TransactionStructApi::SplitTxOut(
     RawTransactionResponseStruct response;
 
     TransactionContext ctx(request.tx);
-    std::vector<Amount> amounts;
-    std::vector<Script> scripts;
     AddressFactory address_factory;
-    for (auto& txout : request.txouts) {
-      amounts.emplace_back(txout.amount);
-      if (!txout.direct_locking_script.empty()) {
-        scripts.emplace_back(Script(txout.direct_locking_script));
-      } else {
-        scripts.emplace_back(
-            address_factory.GetAddress(txout.address).GetLockingScript());
-      }
-    }
-    ctx.SplitTxOut(request.index, amounts, scripts);
+    SplitTxOutByData(request.index, request.txouts, address_factory, &ctx);
 
     response.hex = ctx.GetHex();
     return response;
@@ -942,6 +1015,110 @@ RawTransactionResponseStruct TransactionStructApi::SplitTxOut(
   return result;
 }
 
+RawTransactionResponseStruct TransactionStructApi::EditRawTransaction(
+    const EditRawTransactionRequestStruct& request) {
+  auto call_func = [](const EditRawTransactionRequestStruct& request)
+      -> RawTransactionResponseStruct {  // NOLINT
+    RawTransactionResponseStruct response;
+
+    TransactionContext ctx =
+        (request.tx.empty())
+            ? TransactionContext(request.version, request.locktime)
+            : TransactionContext(request.tx);
+    AddressFactory address_factory;
+    for (const auto& operation : request.operations) {
+      const std::string& type = operation.type;
+      if (type == "addRaw") {
+        for (const auto& txin : operation.txins) {
+          ctx.AddTxIn(Txid(txin.txid), txin.vout, txin.sequence);
+        }
+        for (const auto& txout : operation.txouts) {
+          Amount amount = Amount::CreateBySatoshiAmount(txout.amount);
+          if (!txout.direct_locking_script.empty()) {
+            ctx.AddTxOut(amount, Script(txout.direct_locking_script));
+          } else {
+            ctx.AddTxOut(
+                amount,
+                address_factory.GetAddress(txout.address).GetLockingScript());
+          }
+        }
+      } else if (type == "updateTxOutAmount") {
+        UpdateTxOutAmounts(operation.update_txouts, address_factory, &ctx);
+      } else if (type == "splitTxOut") {
+        SplitTxOutByData(
+            operation.index, operation.split_txouts, address_factory, &ctx);
+      } else if (type == "updateTxInSequence") {
+        auto index = ctx.GetTxInIndex(Txid(operation.txid), operation.vout);
+        ctx.SetTxInSequence(index, operation.sequence);
+      } else if (type == "addSign") {
+        std::vector<SignParameter> sign_params;
+        for (const SignDataStruct& sign_data : operation.sign_params) {
+          sign_params.push_back(
+              TransactionStructApiBase::ConvertSignDataStructToSignParameter(
+                  sign_data));
+        }
+        bool clear_stack = (!operation.is_witness) || operation.clear_stack;
+        ctx.AddSign(
+            OutPoint(Txid(operation.txid), operation.vout), sign_params,
+            operation.is_witness, clear_stack);
+      } else {
+        warn(
+            CFD_LOG_SOURCE,
+            "Failed to EditRawTransaction. Invalid operation type: type={}",
+            type);
+        throw CfdException(
+            CfdError::kCfdIllegalArgumentError,
+            "Invalid operation type. type=" + type);
+      }
+    }
+
+    response.hex = ctx.GetHex();
+    return response;
+  };
+
+  RawTransactionResponseStruct result;
+  result = ExecuteStructApi<
+      EditRawTransactionRequestStruct, RawTransactionResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
+EstimateTransactionSizeResponseStruct
+TransactionStructApi::EstimateTransactionSize(
+    const EstimateTransactionSizeRequestStruct& request) {
+  auto call_func = [](const EstimateTransactionSizeRequestStruct& request)
+      -> EstimateTransactionSizeResponseStruct {  // NOLINT
+    EstimateTransactionSizeResponseStruct response;
+    if (request.fee_rate < 0) {
+      warn(
+          CFD_LOG_SOURCE, "Failed to EstimateTransactionSize. feeRate={}",
+          request.fee_rate);
+      throw CfdException(
+          CfdError::kCfdIllegalArgumentError, "Invalid feeRate.");
+    }
+
+    response.results.reserve(request.candidates.size());
+    for (const auto& candidate : request.candidates) {
+      EstimateTransactionSizeDataStruct data;
+      data.weight = TxSizeEstimator::EstimateWeight(
+          candidate, request.is_elements, request.exponent,
+          request.minimum_bits);
+      data.vsize = (data.weight + 3) / 4;
+      data.fee_amount = static_cast<int64_t>(
+          std::ceil(static_cast<double>(data.vsize) * request.fee_rate));
+      response.results.push_back(data);
+    }
+    return response;
+  };
+
+  EstimateTransactionSizeResponseStruct result;
+  result = ExecuteStructApi<
+      EstimateTransactionSizeRequestStruct,
+      EstimateTransactionSizeResponseStruct>(
+      request, call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 GetIndexDataStruct TransactionStructApi::GetTxInIndex(
     const GetTxInIndexRequestStruct& request) {
   auto call_func = [](const GetTxInIndexRequestStruct& request)
@@ -1052,6 +1229,40 @@ std::vector<Address> TransactionStructApi::ConvertFromLockingScript(
   return addr_list;
 }
 
+std::vector<Address> TransactionStructApi::ConvertFromLockingScript(
+    NetType net_type, const Script& script, std::string* script_type,
+    int64_t* require_num) {
+  auto& cache = LockingScriptCache::GetInstance();
+  LockingScriptCacheData data;
+  if (!cache.Find(net_type, script, &data)) {
+    AddressFactory factory(net_type);
+    data.addresses = ConvertFromLockingScript(
+        factory, script, &data.script_type, &data.require_num);
+    cache.Store(net_type, script, data);
+  }
+  if (script_type != nullptr) *script_type = data.script_type;
+  if (require_num != nullptr) *require_num = data.require_num;
+  return data.addresses;
+}
+
+GetLockingScriptCacheInfoResponseStruct
+TransactionStructApi::GetLockingScriptCacheInfo() {
+  auto call_func = []() -> GetLockingScriptCacheInfoResponseStruct {
+    GetLockingScriptCacheInfoResponseStruct response;
+    const auto& cache = LockingScriptCache::GetInstance();
+    response.capacity = static_cast<int64_t>(cache.GetCapacity());
+    response.size = static_cast<int64_t>(cache.GetSize());
+    response.hit_count = static_cast<int64_t>(cache.GetHitCount());
+    response.miss_count = static_cast<int64_t>(cache.GetMissCount());
+    return response;
+  };
+
+  GetLockingScriptCacheInfoResponseStruct result;
+  result = ExecuteResponseStructApi<GetLockingScriptCacheInfoResponseStruct>(
+      call_func, std::string(__FUNCTION__));
+  return result;
+}
+
 namespace json {
 
 // -----------------------------------------------------------------------------
@@ -1127,6 +1338,17 @@ void TransactionJsonApi::FundRawTransaction(
     select_utxos.push_back(data);
   }
 
+  // The pool stays locked while the transaction is funded.
+  std::shared_ptr<UtxoPool> pool;
+  std::unique_lock<std::mutex> pool_lock;
+  const std::vector<UtxoData>* utxo_list = &utxos;
+  if (request->GetUtxoPoolId() != 0) {
+    pool = UtxoPoolManager::GetInstance().GetPool(
+        request->GetUtxoPoolId(), false, !utxos.empty());
+    pool_lock = pool->GetLock();
+    utxo_list = &pool->GetUtxoDataList();
+  }
+
   // in parameter
   FundFeeInformation& fee_info = request->GetFeeInfo();
   CoinSelectionOption option;
@@ -1143,7 +1365,7 @@ void TransactionJsonApi::FundRawTransaction(
   std::vector<std::string> append_txout_addresses;
   TransactionApi api;
   TransactionController txc = api.FundRawTransaction(
-      request->GetTx(), utxos, target_amount, select_utxos,
+      request->GetTx(), *utxo_list, target_amount, select_utxos,
       request->GetReserveAddress(), fee_info.GetFeeRate(), &fee, nullptr,
       &option, &append_txout_addresses, net_type);
 
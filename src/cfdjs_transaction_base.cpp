@@ -14,7 +14,8 @@
 #include "cfdcore/cfdcore_descriptor.h"
 #include "cfdcore/cfdcore_iterator.h"
 #include "cfdcore/cfdcore_util.h"
-#include "cfdjs_internal.h"  // NOLINT
+#include "cfdjs_internal.h"               // NOLINT
+#include "cfdjs_locking_script_cache.h"  // NOLINT
 
 namespace cfd {
 namespace js {
@@ -286,8 +287,12 @@ SigHashType TransactionStructApiBase::ConvertSigHashType(
   throw CfdException(CfdError::kCfdIllegalArgumentError, err_msg);
 }
 
-ExtractScriptData TransactionStructApiBase::ExtractLockingScript(
-    Script locking_script) {
+/**
+ * @brief Parse the locking script.
+ * @param[in] locking_script    locking script
+ * @return extract script data
+ */
+static ExtractScriptData ParseLockingScript(const Script& locking_script) {
   ExtractScriptData extract_data;
 
   std::string script_type;
@@ -375,6 +380,17 @@ ExtractScriptData TransactionStructApiBase::ExtractLockingScript(
   return extract_data;
 }
 
+ExtractScriptData TransactionStructApiBase::ExtractLockingScript(
+    Script locking_script) {
+  auto& cache = LockingScriptCache::GetInstance();
+  ExtractScriptData extract_data;
+  if (!cache.FindExtractData(locking_script, &extract_data)) {
+    extract_data = ParseLockingScript(locking_script);
+    cache.StoreExtractData(locking_script, extract_data);
+  }
+  return extract_data;
+}
+
 std::string TransactionStructApiBase::ConvertLockingScriptTypeString(
     LockingScriptType script_type) {
   switch (script_type) {
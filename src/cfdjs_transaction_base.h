@@ -55,7 +55,7 @@ enum LockingScriptType {
 struct ExtractScriptData {
   LockingScriptType script_type;       //!< LockingScript type
   std::vector<ByteData> pushed_datas;  //!< hashed data by locking script
-  int64_t req_sigs;                    //!< multisig unlocking signature num
+  int64_t req_sigs = 0;                //!< multisig unlocking signature num
   //! Witness version
   WitnessVersion witness_version = WitnessVersion::kVersionNone;
 };
@@ -98,6 +98,7 @@ class TransactionStructApiBase {
 
   /**
    * @brief LockingScriptの解析を行う.
+   * @details 解析結果は LockingScriptCache に保持する.
    * @param[in] locking_script LockingScriptデータ
    * @return 解析された ExtractScriptData インスタンス
    */
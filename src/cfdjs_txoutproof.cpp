@@ -0,0 +1,207 @@
+// Copyright 2021 CryptoGarage
+/**
+ * @file cfdjs_txoutproof.cpp
+ *
+ * @brief Implementation of the txoutproof (merkle block) verification.
+ */
+#include "cfdjs_txoutproof.h"  // NOLINT
+
+#include <string>
+#include <vector>
+
+#include "cfdcore/cfdcore_exception.h"
+#include "cfdcore/cfdcore_logger.h"
+#include "cfdcore/cfdcore_util.h"
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::core::CfdError;
+using cfd::core::CfdException;
+using cfd::core::HashUtil;
+using cfd::core::logger::warn;
+
+constexpr uint32_t TxOutProof::kMaxTransactionCount;
+
+//! block header size
+static constexpr size_t kBlockHeaderSize = 80;
+//! offset of the merkle root in the block header
+static constexpr size_t kMerkleRootOffset = 36;
+
+/**
+ * @brief Read a little endian number.
+ * @param[in] bytes     buffer
+ * @param[in] size      number size
+ * @param[in,out] offset    read offset
+ * @param[out] value    number
+ * @retval true   success
+ * @retval false  out of range
+ */
+static bool ReadNumber(
+    const std::vector<uint8_t>& bytes, size_t size, size_t* offset,
+    uint64_t* value) {
+  if (bytes.size() < *offset + size) return false;
+  uint64_t result = 0;
+  for (size_t index = 0; index < size; ++index) {
+    result |= static_cast<uint64_t>(bytes[*offset + index]) << (index * 8);
+  }
+  *offset += size;
+  *value = result;
+  return true;
+}
+
+/**
+ * @brief Read a variable integer.
+ * @param[in] bytes     buffer
+ * @param[in,out] offset    read offset
+ * @param[out] value    number
+ * @retval true   success
+ * @retval false  out of range
+ */
+static bool ReadVarInt(
+    const std::vector<uint8_t>& bytes, size_t* offset, uint64_t* value) {
+  uint64_t head = 0;
+  if (!ReadNumber(bytes, 1, offset, &head)) return false;
+  if (head < 0xfd) {
+    *value = head;
+    return true;
+  }
+  size_t size = (head == 0xfd) ? 2 : (head == 0xfe) ? 4 : 8;
+  return ReadNumber(bytes, size, offset, value);
+}
+
+TxOutProof::TxOutProof(const ByteData& proof) : transaction_count_(0) {
+  const std::vector<uint8_t> bytes = proof.GetBytes();
+  Parse(bytes);
+  block_hash_ = BlockHash(HashUtil::Sha256D(ByteData(std::vector<uint8_t>(
+      bytes.begin(), bytes.begin() + kBlockHeaderSize))));
+}
+
+TxOutProof::TxOutProof(const ByteData& proof, const BlockHash& block_hash)
+    : transaction_count_(0), block_hash_(block_hash) {
+  Parse(proof.GetBytes());
+}
+
+std::string TxOutProof::GetBlockHeaderKey(const std::string& proof) {
+  return proof.substr(0, kBlockHeaderSize * 2);
+}
+
+BlockHash TxOutProof::GetBlockHash(const std::string& header_key) {
+  if (header_key.size() != kBlockHeaderSize * 2) {
+    warn(CFD_LOG_SOURCE, "Failed to TxOutProof. invalid header size.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError, "txoutproof is invalid.");
+  }
+  return BlockHash(HashUtil::Sha256D(ByteData(header_key)));
+}
+
+void TxOutProof::Parse(const std::vector<uint8_t>& bytes) {
+  size_t offset = kBlockHeaderSize;
+  uint64_t transaction_count = 0;
+  uint64_t hash_count = 0;
+  uint64_t flag_size = 0;
+  bool is_valid = ReadNumber(bytes, 4, &offset, &transaction_count) &&
+                  ReadVarInt(bytes, &offset, &hash_count) &&
+                  (hash_count <= transaction_count) &&
+                  (bytes.size() >= offset + (hash_count * 32));
+  if (is_valid) {
+    hashes_.reserve(static_cast<size_t>(hash_count));
+    for (uint64_t index = 0; index < hash_count; ++index) {
+      hashes_.emplace_back(std::vector<uint8_t>(
+          bytes.begin() + offset, bytes.begin() + offset + 32));
+      offset += 32;
+    }
+    is_valid = ReadVarInt(bytes, &offset, &flag_size) &&
+               ((bytes.size() - offset) == flag_size) &&
+               (flag_size * 8 >= hash_count);
+  }
+  if (!is_valid || (transaction_count == 0) ||
+      (transaction_count > kMaxTransactionCount)) {
+    warn(CFD_LOG_SOURCE, "Failed to TxOutProof. invalid format.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError, "txoutproof is invalid.");
+  }
+  transaction_count_ = static_cast<uint32_t>(transaction_count);
+  bits_.reserve(static_cast<size_t>(flag_size * 8));
+  for (uint64_t index = 0; index < flag_size * 8; ++index) {
+    bits_.push_back(((bytes[offset + (index / 8)] >> (index % 8)) & 1) != 0);
+  }
+
+  uint32_t height = 0;
+  while (GetTreeWidth(height) > 1) ++height;
+  size_t bit_index = 0;
+  size_t hash_index = 0;
+  ByteData256 merkle_root;
+  is_valid =
+      TraverseAndExtract(height, 0, &bit_index, &hash_index, &merkle_root) &&
+      (((bit_index + 7) / 8) == flag_size) && (hash_index == hashes_.size());
+  const std::vector<uint8_t> header_root(
+      bytes.begin() + kMerkleRootOffset,
+      bytes.begin() + kMerkleRootOffset + 32);
+  if (!is_valid || (merkle_root.GetBytes() != header_root)) {
+    warn(CFD_LOG_SOURCE, "Failed to TxOutProof. merkle root unmatch.");
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError, "txoutproof is invalid.");
+  }
+  hashes_.clear();
+  bits_.clear();
+}
+
+const BlockHash& TxOutProof::GetBlockHash() const { return block_hash_; }
+
+const std::vector<Txid>& TxOutProof::GetTxids() const { return txids_; }
+
+bool TxOutProof::IsMatch(const Txid& txid) const {
+  for (const auto& matched_txid : txids_) {
+    if (matched_txid.Equals(txid)) return true;
+  }
+  return false;
+}
+
+uint32_t TxOutProof::GetTreeWidth(uint32_t height) const {
+  return static_cast<uint32_t>(
+      (static_cast<uint64_t>(transaction_count_) + (1ULL << height) - 1) >>
+      height);
+}
+
+bool TxOutProof::TraverseAndExtract(
+    uint32_t height, uint32_t position, size_t* bit_index,
+    size_t* hash_index, ByteData256* node_hash) {
+  if (*bit_index >= bits_.size()) return false;
+  bool is_parent_of_match = bits_[(*bit_index)++];
+  if ((height == 0) || !is_parent_of_match) {
+    if (*hash_index >= hashes_.size()) return false;
+    *node_hash = hashes_[(*hash_index)++];
+    if ((height == 0) && is_parent_of_match) {
+      txids_.emplace_back(*node_hash);
+    }
+    return true;
+  }
+
+  ByteData256 left;
+  ByteData256 right;
+  if (!TraverseAndExtract(
+          height - 1, position * 2, bit_index, hash_index, &left)) {
+    return false;
+  }
+  if ((position * 2 + 1) < GetTreeWidth(height - 1)) {
+    if (!TraverseAndExtract(
+            height - 1, position * 2 + 1, bit_index, hash_index, &right)) {
+      return false;
+    }
+    // identical siblings are rejected (CVE-2012-2459)
+    if (left.Equals(right)) return false;
+  } else {
+    right = left;
+  }
+  std::vector<uint8_t> node = left.GetBytes();
+  const std::vector<uint8_t> right_bytes = right.GetBytes();
+  node.insert(node.end(), right_bytes.begin(), right_bytes.end());
+  *node_hash = HashUtil::Sha256D(ByteData(node));
+  return true;
+}
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
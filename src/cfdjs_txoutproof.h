@@ -0,0 +1,132 @@
+// Copyright 2021 CryptoGarage
+/**
+ * @file cfdjs_txoutproof.h
+ *
+ * @brief Definition of the txoutproof (merkle block) verification.
+ */
+#ifndef CFD_JS_SRC_CFDJS_TXOUTPROOF_H_
+#define CFD_JS_SRC_CFDJS_TXOUTPROOF_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cfdcore/cfdcore_bytedata.h"
+#include "cfdcore/cfdcore_coin.h"
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::core::BlockHash;
+using cfd::core::ByteData;
+using cfd::core::ByteData256;
+using cfd::core::Txid;
+
+/**
+ * @brief Verified txoutproof.
+ * @details The partial merkle tree is walked in the same way as bitcoin
+ *     core (CPartialMerkleTree::ExtractMatches), and the computed root must
+ *     match the merkle root of the block header. The proof of work is not
+ *     checked.
+ */
+class TxOutProof {
+ public:
+  //! max transaction count of a block (max weight / min tx weight)
+  static constexpr uint32_t kMaxTransactionCount = 16666;
+
+  /**
+   * @brief constructor.
+   * @param[in] proof   txoutproof (merkle block)
+   * @throw CfdException  invalid txoutproof
+   */
+  explicit TxOutProof(const ByteData& proof);
+
+  /**
+   * @brief constructor with the block hash of the header.
+   * @details Use this when another txoutproof of the same block header has
+   *     already been hashed. The partial merkle tree is still verified.
+   * @param[in] proof       txoutproof (merkle block)
+   * @param[in] block_hash  block hash of the txoutproof header
+   * @throw CfdException  invalid txoutproof
+   */
+  TxOutProof(const ByteData& proof, const BlockHash& block_hash);
+
+  /**
+   * @brief Get the block header key of the txoutproof.
+   * @details The txoutproof starts with the 80 byte block header, so
+   *     txoutproofs with the same key are proofs of the same block.
+   * @param[in] proof   txoutproof hex
+   * @return block header hex
+   */
+  static std::string GetBlockHeaderKey(const std::string& proof);
+
+  /**
+   * @brief Get the block hash of the block header key.
+   * @param[in] header_key   block header hex (GetBlockHeaderKey)
+   * @return block hash
+   */
+  static BlockHash GetBlockHash(const std::string& header_key);
+
+  /**
+   * @brief Get the block hash.
+   * @return block hash
+   */
+  const BlockHash& GetBlockHash() const;
+
+  /**
+   * @brief Get the matched txid list.
+   * @return txid list (tree order)
+   */
+  const std::vector<Txid>& GetTxids() const;
+
+  /**
+   * @brief Check if the txid is proven by this proof.
+   * @param[in] txid    txid
+   * @retval true   matched
+   * @retval false  not matched
+   */
+  bool IsMatch(const Txid& txid) const;
+
+ private:
+  /**
+   * @brief Parse and verify the partial merkle tree.
+   * @param[in] bytes   txoutproof
+   * @throw CfdException  invalid txoutproof
+   */
+  void Parse(const std::vector<uint8_t>& bytes);
+
+  /**
+   * @brief Get the tree width of the height.
+   * @param[in] height    tree height (0: leaves)
+   * @return node count
+   */
+  uint32_t GetTreeWidth(uint32_t height) const;
+
+  /**
+   * @brief Walk the partial merkle tree.
+   * @param[in] height      node height
+   * @param[in] position    node position
+   * @param[in,out] bit_index   used flag bit count
+   * @param[in,out] hash_index  used hash count
+   * @param[out] node_hash      node hash
+   * @retval true   success
+   * @retval false  invalid tree
+   */
+  bool TraverseAndExtract(
+      uint32_t height, uint32_t position, size_t* bit_index,
+      size_t* hash_index, ByteData256* node_hash);
+
+  uint32_t transaction_count_;       //!< block transaction count
+  std::vector<ByteData256> hashes_;  //!< partial tree hash list
+  std::vector<bool> bits_;           //!< partial tree flag bits
+  BlockHash block_hash_;             //!< block hash
+  std::vector<Txid> txids_;          //!< matched txid list
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_SRC_CFDJS_TXOUTPROOF_H_
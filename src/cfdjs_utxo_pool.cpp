@@ -0,0 +1,264 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_utxo_pool.cpp
+ *
+ * @brief Implementation of the persistent utxo pool.
+ */
+#include "cfdjs_utxo_pool.h"  // NOLINT
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "cfdapi_select_utxos_wrapper_json.h"  // NOLINT
+#include "cfdcore/cfdcore_address.h"
+#include "cfdcore/cfdcore_amount.h"
+#include "cfdcore/cfdcore_coin.h"
+#include "cfdcore/cfdcore_elements_transaction.h"
+#include "cfdcore/cfdcore_exception.h"
+#include "cfdcore/cfdcore_logger.h"
+#include "cfdcore/cfdcore_script.h"
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::core::Address;
+using cfd::core::Amount;
+using cfd::core::CfdError;
+using cfd::core::CfdException;
+using cfd::core::Script;
+using cfd::core::Txid;
+using cfd::core::logger::warn;
+using cfd::js::api::json::SelectUtxosWrapRequest;
+#ifndef CFD_DISABLE_ELEMENTS
+using cfd::core::ConfidentialAssetId;
+#endif  // CFD_DISABLE_ELEMENTS
+
+// -----------------------------------------------------------------------------
+// UtxoPool
+// -----------------------------------------------------------------------------
+UtxoPool::UtxoPool(uint32_t pool_id, bool is_elements)
+    : pool_id_(pool_id),
+      is_elements_(is_elements),
+      locked_count_(0),
+      next_sequence_(0),
+      is_dirty_(false) {
+  // do nothing
+}
+
+uint32_t UtxoPool::GetPoolId() const { return pool_id_; }
+
+bool UtxoPool::IsElements() const { return is_elements_; }
+
+std::unique_lock<std::mutex> UtxoPool::GetLock() {
+  return std::unique_lock<std::mutex>(mutex_);
+}
+
+void UtxoPool::AddUtxos(const std::vector<UtxoPoolItemDataStruct>& utxos) {
+  for (const auto& item : utxos) {
+    Txid txid(item.txid);
+    UtxoJsonDataStruct json_struct;
+    json_struct.txid = txid.GetHex();
+    json_struct.vout = item.vout;
+    json_struct.amount = item.amount;
+    json_struct.asset = item.asset;
+    json_struct.descriptor = item.descriptor;
+    json_struct.script_sig_template = item.script_sig_template;
+
+    UtxoData data = {};
+    data.txid = txid;
+    data.vout = item.vout;
+    data.amount = Amount::CreateBySatoshiAmount(item.amount);
+    data.descriptor = item.descriptor;
+    data.binary_data = nullptr;
+    if (!item.script_sig_template.empty()) {
+      data.scriptsig_template = Script(item.script_sig_template);
+    }
+    if (!is_elements_) {
+      if (!item.address.empty()) data.address = Address(item.address);
+    } else {
+#ifndef CFD_DISABLE_ELEMENTS
+      if (!item.asset.empty()) data.asset = ConfidentialAssetId(item.asset);
+#endif  // CFD_DISABLE_ELEMENTS
+    }
+
+    UtxoPoolEntry temp_entry;
+    temp_entry.json_data.ConvertFromStruct(json_struct);
+    SelectUtxosWrapRequest::ConvertToUtxo(
+        temp_entry.json_data, &temp_entry.utxo);
+    temp_entry.utxo_data = data;
+
+    // An existing entry keeps its order and lock state. binary_data must
+    // point to the json data owned by the map node.
+    auto ite = entries_.find(CreateKey(json_struct.txid, item.vout));
+    if (ite == entries_.end()) {
+      temp_entry.sequence = next_sequence_++;
+      ite = entries_.emplace(
+          CreateKey(json_struct.txid, item.vout), temp_entry).first;
+    } else {
+      temp_entry.sequence = ite->second.sequence;
+      temp_entry.is_locked = ite->second.is_locked;
+      ite->second = temp_entry;
+    }
+    UtxoPoolEntry& entry = ite->second;
+    entry.utxo.binary_data = &entry.json_data;
+    is_dirty_ = true;
+  }
+}
+
+void UtxoPool::RemoveUtxos(const std::vector<OutPointStruct>& outpoints) {
+  for (const auto& outpoint : outpoints) {
+    auto ite = entries_.find(
+        CreateKey(Txid(outpoint.txid).GetHex(), outpoint.vout));
+    if (ite == entries_.end()) continue;
+    if (ite->second.is_locked) --locked_count_;
+    entries_.erase(ite);
+    is_dirty_ = true;
+  }
+}
+
+void UtxoPool::LockUtxos(
+    const std::vector<OutPointStruct>& outpoints, bool is_lock) {
+  for (const auto& outpoint : outpoints) {
+    auto ite = entries_.find(
+        CreateKey(Txid(outpoint.txid).GetHex(), outpoint.vout));
+    if (ite == entries_.end()) {
+      warn(
+          CFD_LOG_SOURCE, "Failed to LockUtxos. utxo not found.: {},{}",
+          outpoint.txid, outpoint.vout);
+      throw CfdException(
+          CfdError::kCfdIllegalArgumentError,
+          "Failed to LockUtxos. utxo not found in the pool.");
+    }
+    if (ite->second.is_locked != is_lock) {
+      ite->second.is_locked = is_lock;
+      if (is_lock) {
+        ++locked_count_;
+      } else {
+        --locked_count_;
+      }
+      is_dirty_ = true;
+    }
+  }
+}
+
+const std::vector<Utxo>& UtxoPool::GetUtxoList() {
+  if (is_dirty_) UpdateList();
+  return utxo_list_;
+}
+
+const std::vector<UtxoData>& UtxoPool::GetUtxoDataList() {
+  if (is_dirty_) UpdateList();
+  return utxo_data_list_;
+}
+
+void UtxoPool::GetInfo(UtxoPoolInfoResponseStruct* response) const {
+  response->pool_id = pool_id_;
+  response->count = static_cast<uint32_t>(entries_.size());
+  response->locked_count = locked_count_;
+}
+
+std::string UtxoPool::CreateKey(const std::string& txid, uint32_t vout) {
+  return txid + ":" + std::to_string(vout);
+}
+
+void UtxoPool::UpdateList() {
+  std::vector<const UtxoPoolEntry*> targets;
+  targets.reserve(entries_.size() - locked_count_);
+  for (const auto& entry : entries_) {
+    if (!entry.second.is_locked) targets.push_back(&entry.second);
+  }
+  std::sort(
+      targets.begin(), targets.end(),
+      [](const UtxoPoolEntry* lhs, const UtxoPoolEntry* rhs) -> bool {
+        return lhs->sequence < rhs->sequence;
+      });
+
+  utxo_list_.clear();
+  utxo_data_list_.clear();
+  utxo_list_.reserve(targets.size());
+  utxo_data_list_.reserve(targets.size());
+  for (const auto* entry : targets) {
+    utxo_list_.push_back(entry->utxo);
+    utxo_data_list_.push_back(entry->utxo_data);
+  }
+  is_dirty_ = false;
+}
+
+// -----------------------------------------------------------------------------
+// UtxoPoolManager
+// -----------------------------------------------------------------------------
+UtxoPoolManager& UtxoPoolManager::GetInstance() {
+  static UtxoPoolManager instance;
+  return instance;
+}
+
+UtxoPoolManager::UtxoPoolManager() : next_pool_id_(1) {
+  // do nothing
+}
+
+std::shared_ptr<UtxoPool> UtxoPoolManager::CreatePool(bool is_elements) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint32_t pool_id = next_pool_id_++;
+  if (next_pool_id_ == 0) next_pool_id_ = 1;
+  auto pool = std::make_shared<UtxoPool>(pool_id, is_elements);
+  pools_[pool_id] = pool;
+  return pool;
+}
+
+std::shared_ptr<UtxoPool> UtxoPoolManager::GetPool(
+    uint32_t pool_id, bool is_elements, bool has_utxos) {
+  if (has_utxos) {
+    warn(
+        CFD_LOG_SOURCE,
+        "Failed to GetPool. utxos and utxoPoolId are exclusive.: id={}",
+        pool_id);
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to GetPool. utxos and utxoPoolId cannot be set together.");
+  }
+  auto pool = GetPool(pool_id);
+  if (pool->IsElements() != is_elements) {
+    warn(
+        CFD_LOG_SOURCE,
+        "Failed to GetPool. network type unmatch.: id={}, isElements={}",
+        pool_id, is_elements);
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to GetPool. utxo pool network type unmatch.");
+  }
+  return pool;
+}
+
+std::shared_ptr<UtxoPool> UtxoPoolManager::GetPool(uint32_t pool_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto ite = pools_.find(pool_id);
+  if (ite == pools_.end()) {
+    warn(CFD_LOG_SOURCE, "Failed to GetPool. pool not found.: id={}", pool_id);
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to GetPool. utxo pool not found.");
+  }
+  return ite->second;
+}
+
+std::shared_ptr<UtxoPool> UtxoPoolManager::DeletePool(uint32_t pool_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto ite = pools_.find(pool_id);
+  if (ite == pools_.end()) {
+    warn(
+        CFD_LOG_SOURCE, "Failed to DeletePool. pool not found.: id={}",
+        pool_id);
+    throw CfdException(
+        CfdError::kCfdIllegalArgumentError,
+        "Failed to DeletePool. utxo pool not found.");
+  }
+  auto pool = ite->second;
+  pools_.erase(ite);
+  return pool;
+}
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
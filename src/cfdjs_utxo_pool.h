@@ -0,0 +1,188 @@
+// Copyright 2020 CryptoGarage
+/**
+ * @file cfdjs_utxo_pool.h
+ *
+ * @brief Definition of the persistent utxo pool.
+ */
+#ifndef CFD_JS_SRC_CFDJS_UTXO_POOL_H_
+#define CFD_JS_SRC_CFDJS_UTXO_POOL_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>  // NOLINT
+#include <string>
+#include <vector>
+
+#include "cfd/cfd_utxo.h"
+#include "cfd_js_api_json_autogen.h"  // NOLINT
+#include "cfdjs/cfdjs_struct.h"
+
+namespace cfd {
+namespace js {
+namespace api {
+
+using cfd::Utxo;
+using cfd::UtxoData;
+
+/**
+ * @brief Pre-parsed utxo pool entry.
+ */
+struct UtxoPoolEntry {
+  json::UtxoJsonData json_data;  //!< utxo json data (for SelectUtxos)
+  Utxo utxo;                     //!< coin selection utxo
+  UtxoData utxo_data;            //!< utxo data (for FundRawTransaction)
+  uint64_t sequence = 0;         //!< insertion order
+  bool is_locked = false;        //!< lock flag
+};
+
+/**
+ * @brief Utxo pool holding pre-parsed utxos.
+ * @details The pool converts each utxo only once when it is added, so
+ *     SelectUtxos and FundRawTransaction can reuse the converted data.
+ *     Accessors of the utxo list require the pool lock. (see GetLock)
+ */
+class UtxoPool {
+ public:
+  /**
+   * @brief constructor.
+   * @param[in] pool_id       pool id
+   * @param[in] is_elements   elements utxo flag
+   */
+  UtxoPool(uint32_t pool_id, bool is_elements);
+
+  /**
+   * @brief Get the pool id.
+   * @return pool id
+   */
+  uint32_t GetPoolId() const;
+  /**
+   * @brief Get the elements utxo flag.
+   * @return elements utxo flag
+   */
+  bool IsElements() const;
+
+  /**
+   * @brief Acquire the pool lock.
+   * @return lock object
+   */
+  std::unique_lock<std::mutex> GetLock();
+
+  /**
+   * @brief Add utxos. An existing outpoint is overwritten. (need lock)
+   * @param[in] utxos   utxo list
+   */
+  void AddUtxos(const std::vector<UtxoPoolItemDataStruct>& utxos);
+  /**
+   * @brief Remove utxos. An unknown outpoint is ignored. (need lock)
+   * @param[in] outpoints   outpoint list
+   */
+  void RemoveUtxos(const std::vector<OutPointStruct>& outpoints);
+  /**
+   * @brief Lock or unlock utxos. (need lock)
+   * @param[in] outpoints   outpoint list
+   * @param[in] is_lock     true is lock, false is unlock
+   */
+  void LockUtxos(const std::vector<OutPointStruct>& outpoints, bool is_lock);
+
+  /**
+   * @brief Get the unlocked coin selection utxo list. (need lock)
+   * @details The list keeps the insertion order. binary_data of each utxo
+   *     refers to the json data in the pool.
+   * @return utxo list
+   */
+  const std::vector<Utxo>& GetUtxoList();
+  /**
+   * @brief Get the unlocked utxo data list. (need lock)
+   * @return utxo data list
+   */
+  const std::vector<UtxoData>& GetUtxoDataList();
+
+  /**
+   * @brief Set the pool information to the response. (need lock)
+   * @param[out] response   response struct
+   */
+  void GetInfo(UtxoPoolInfoResponseStruct* response) const;
+
+ private:
+  /**
+   * @brief Create an entry key.
+   * @param[in] txid    txid
+   * @param[in] vout    vout
+   * @return entry key
+   */
+  static std::string CreateKey(const std::string& txid, uint32_t vout);
+  /**
+   * @brief Rebuild the unlocked utxo list. (need lock)
+   */
+  void UpdateList();
+
+  uint32_t pool_id_;  //!< pool id
+  bool is_elements_;  //!< elements utxo flag
+  std::mutex mutex_;  //!< mutex
+  //! entry map (node-stable for binary_data)
+  std::map<std::string, UtxoPoolEntry> entries_;
+  uint32_t locked_count_;                 //!< locked entry count
+  uint64_t next_sequence_;                //!< next insertion order
+  bool is_dirty_;                         //!< list rebuild flag
+  std::vector<Utxo> utxo_list_;           //!< unlocked utxo list
+  std::vector<UtxoData> utxo_data_list_;  //!< unlocked utxo data list
+};
+
+/**
+ * @brief Registry of utxo pools. All methods are thread-safe.
+ */
+class UtxoPoolManager {
+ public:
+  /**
+   * @brief Get the process-wide manager instance.
+   * @return manager instance
+   */
+  static UtxoPoolManager& GetInstance();
+
+  /**
+   * @brief Create a new pool.
+   * @param[in] is_elements   elements utxo flag
+   * @return pool
+   */
+  std::shared_ptr<UtxoPool> CreatePool(bool is_elements);
+  /**
+   * @brief Get the pool used in place of the request utxos.
+   * @param[in] pool_id       pool id
+   * @param[in] is_elements   elements utxo flag
+   * @param[in] has_utxos     request utxos flag
+   * @return pool
+   * @throw CfdException  pool is not found, network type is unmatch, or
+   *     the request also has utxos.
+   */
+  std::shared_ptr<UtxoPool> GetPool(
+      uint32_t pool_id, bool is_elements, bool has_utxos);
+  /**
+   * @brief Get the pool.
+   * @param[in] pool_id       pool id
+   * @return pool
+   * @throw CfdException  pool is not found.
+   */
+  std::shared_ptr<UtxoPool> GetPool(uint32_t pool_id);
+  /**
+   * @brief Delete the pool.
+   * @param[in] pool_id       pool id
+   * @return deleted pool
+   * @throw CfdException  pool is not found.
+   */
+  std::shared_ptr<UtxoPool> DeletePool(uint32_t pool_id);
+
+ private:
+  UtxoPoolManager();
+
+  std::mutex mutex_;       //!< mutex
+  uint32_t next_pool_id_;  //!< next pool id
+  //! pool map
+  std::map<uint32_t, std::shared_ptr<UtxoPool>> pools_;
+};
+
+}  // namespace api
+}  // namespace js
+}  // namespace cfd
+
+#endif  // CFD_JS_SRC_CFDJS_UTXO_POOL_H_
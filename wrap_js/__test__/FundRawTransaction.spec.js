@@ -1,4 +1,7 @@
-const {FundRawTransaction} = require('../cfdjs_raw_module');
+const {
+  FundRawTransaction, CreateUtxoPool, AddUtxoPoolItems, LockUtxoPoolItems,
+  DeleteUtxoPool,
+} = require('../cfdjs_raw_module');
 const TestHelper = require('./TestHelper');
 const TestUtxoCreater = require('./TestUtxoCreater');
 
@@ -21,6 +24,26 @@ const createFeeInfo = (feeRate, minChange = -1) => {
   };
 };
 
+// Fund with the request utxos registered to a utxo pool.
+const fundRawTransactionOnUtxoPool = (requestJson, lockOutpoints = []) => {
+  const request = JSON.parse(requestJson);
+  const pool = JSON.parse(CreateUtxoPool(
+    JSON.stringify({isElements: request.isElements})));
+  try {
+    AddUtxoPoolItems(
+      JSON.stringify({poolId: pool.poolId, utxos: request.utxos}));
+    if (lockOutpoints.length > 0) {
+      LockUtxoPoolItems(
+        JSON.stringify({poolId: pool.poolId, outpoints: lockOutpoints}));
+    }
+    delete request.utxos;
+    request.utxoPoolId = pool.poolId;
+    return FundRawTransaction(JSON.stringify(request));
+  } finally {
+    DeleteUtxoPool(JSON.stringify({poolId: pool.poolId}));
+  }
+};
+
 const testCase = [
   (() => {
     const utxos = TestUtxoCreater.createUtxos([0.1, 0.2, 0.3, 0.4, 0.5], FIXED_DESCRIPTOR);
@@ -355,6 +378,41 @@ const testCase = [
       '{"hex":"020000000100000020000000000000000000000000000000000000000000000000000000000000000000ffffffff011a2c3101000000001976a91420a5f2c59d3d62a1108e8ce3c5e01133f383039f88ac00000000","usedAddresses":["miVaiV4Hq3qszYy6CyhLiG3vKPw7dCMC9k"],"feeAmount":230}',
     );
   })(),
+  (() => {
+    const utxos = TestUtxoCreater.createUtxos([0.1, 0.2, 0.3, 0.4, 0.5], FIXED_DESCRIPTOR);
+    return TestHelper.createBitcoinTestCase(
+      'FundRawTransaction (tx: 0 input(0 btc) 0 output(0 btc), targetAmount: 11000000, feeRate: 0, utxo pool)',
+      fundRawTransactionOnUtxoPool,
+      [JSON.stringify({
+        utxos,
+        tx: '02000000000000000000',
+        isElements: false,
+        network: 'mainnet',
+        targetAmount: (Math.floor(0.11 * COIN_BASE)),
+        reserveAddress: '13ydRRyK22QdDSVUVQixtLqbTQLQmbxrfY',
+        feeInfo: createFeeInfo(0.0),
+      })],
+      '{"hex":"020000000100000020000000000000000000000000000000000000000000000000000000000000000000ffffffff01002d3101000000001976a91420a5f2c59d3d62a1108e8ce3c5e01133f383039f88ac00000000","usedAddresses":["13ydRRyK22QdDSVUVQixtLqbTQLQmbxrfY"],"feeAmount":0}',
+    );
+  })(),
+  // The locked 0.2 btc utxo is skipped, so the next larger utxo is used.
+  (() => {
+    const utxos = TestUtxoCreater.createUtxos([0.1, 0.2, 0.3, 0.4, 0.5], FIXED_DESCRIPTOR);
+    return TestHelper.createBitcoinTestCase(
+      'FundRawTransaction (tx: 0 input(0 btc) 0 output(0 btc), targetAmount: 11000000, feeRate: 0, utxo pool with locked utxo)',
+      fundRawTransactionOnUtxoPool,
+      [JSON.stringify({
+        utxos,
+        tx: '02000000000000000000',
+        isElements: false,
+        network: 'mainnet',
+        targetAmount: (Math.floor(0.11 * COIN_BASE)),
+        reserveAddress: '13ydRRyK22QdDSVUVQixtLqbTQLQmbxrfY',
+        feeInfo: createFeeInfo(0.0),
+      }), [{txid: utxos[1].txid, vout: utxos[1].vout}]],
+      '{"hex":"020000000100000030000000000000000000000000000000000000000000000000000000000000000000ffffffff0180c3c901000000001976a91420a5f2c59d3d62a1108e8ce3c5e01133f383039f88ac00000000","usedAddresses":["13ydRRyK22QdDSVUVQixtLqbTQLQmbxrfY"],"feeAmount":0}',
+    );
+  })(),
 ];
 
 
@@ -402,6 +460,24 @@ const errorCase = [
       '{"error":{"code":1,"type":"illegal_argument","message":"Failed to FundRawTransaction. Input address and network is unmatch."}}',
     );
   })(),
+  (() => {
+    const utxos = TestUtxoCreater.createUtxos([0.1, 0.2, 0.3, 0.4, 0.5], FIXED_DESCRIPTOR);
+    return TestHelper.createBitcoinTestCase(
+      'FundRawTransaction - Error - utxos and utxoPoolId',
+      FundRawTransaction,
+      [JSON.stringify({
+        utxos,
+        utxoPoolId: 4294967295,
+        tx: '02000000000000000000',
+        isElements: false,
+        network: 'mainnet',
+        targetAmount: (Math.floor(0.11 * COIN_BASE)),
+        reserveAddress: '13ydRRyK22QdDSVUVQixtLqbTQLQmbxrfY',
+        feeInfo: createFeeInfo(0.0),
+      })],
+      '{"error":{"code":1,"type":"illegal_argument","message":"Failed to GetPool. utxos and utxoPoolId cannot be set together."}}',
+    );
+  })(),
 ];
 
 const elementsTestCase = [
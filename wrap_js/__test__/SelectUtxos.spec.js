@@ -1,4 +1,6 @@
-const {SelectUtxos} = require('../cfdjs_raw_module');
+const {
+  SelectUtxos, SelectUtxosBatch, ReselectUtxos,
+} = require('../cfdjs_raw_module');
 const TestHelper = require('./TestHelper');
 
 const emptyFunc = () => {};
@@ -27,6 +29,31 @@ const convertFunc = (jsonString) => {
   }
 };
 
+const convertBatchFunc = (jsonString) => {
+  const {results, totalFeeAmount} = JSON.parse(jsonString);
+  const payouts = results.map((result) => JSON.stringify(result))
+    .map(convertFunc);
+  return {payouts, totalFeeAmount};
+};
+
+const convertReselectFunc = (jsonString) => {
+  const {addedUtxos, isFullSearch} = JSON.parse(jsonString);
+  const retObj = convertFunc(jsonString);
+  return Object.assign(retObj, {addedNum: addedUtxos.length, isFullSearch});
+};
+
+// tries and elapsedTime depend on the thread timing, so they are not checked.
+const convertBnbFunc = (jsonString) => {
+  const {bnbStatistics} = JSON.parse(jsonString);
+  const retObj = convertFunc(jsonString);
+  const {
+    isSelected, threadCount, subtreeCount, isTimeout, isCompleted,
+  } = bnbStatistics;
+  return Object.assign(retObj, {bnbStatistics: {
+    isSelected, threadCount, subtreeCount, isTimeout, isCompleted,
+  }});
+};
+
 const COIN_BASE = 100000000;
 const ZERO_BASE = '0000000000000000000000000000000000000000000000000000000000000000';
 const FIXED_DESCRIPTOR = 'sh(wpkh([ef735203/0\'/0\'/5\']03948c01f159b4204b682668d6e850440564b6610c0e5bf30da684b2131f77c449))#2u75feqc';
@@ -55,6 +82,21 @@ const clearUtxos = () => {
   utxos = [];
 };
 
+// same layout as the selection state of SelectUtxos.
+// (version, flags, utxo count, [txid, vout, txin vsize])
+const toUint32Hex = (value) => {
+  const buf = Buffer.alloc(4);
+  buf.writeUInt32LE(value);
+  return buf.toString('hex');
+};
+const testSelectionState = (utxos, vsize, isChangeless = false) => '01' +
+  (isChangeless ? '01' : '00') + toUint32Hex(utxos.length) +
+  utxos.map((utxo) => (
+    utxo.txid + toUint32Hex(utxo.vout) + toUint32Hex(vsize)
+  )).join('');
+// txin vsize of FIXED_DESCRIPTOR
+const FIXED_DESCRIPTOR_VSIZE = 91;
+
 const FIXED_BITCOIN_FEE_INFO = {
   txFeeAmount: 1000,
   feeRate: 0,
@@ -176,6 +218,348 @@ const testCase = [
       convertFunc,
     );
   })(),
+  (() => {
+    const utxos = testUtxos([1, 2, 5, 10, 20]);
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxos columnar 38[1,2,5,10,20]coins, req: 34 coins',
+      SelectUtxos,
+      [JSON.stringify({
+        utxos,
+        targetAmount: (34 * COIN_BASE),
+        isElements: false,
+        feeInfo: FIXED_BITCOIN_FEE_INFO,
+        selectionMode: 'columnar',
+      })],
+      {amount: (35 * COIN_BASE), coinNum: 3, feeAmount: 1000},
+      emptyFunc,
+      clearUtxos,
+      convertFunc,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([1, 2, 5]);
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxos columnar selectionState 8[1,2,5]coins, req: 4 coins',
+      SelectUtxos,
+      [JSON.stringify({
+        utxos,
+        targetAmount: (4 * COIN_BASE),
+        isElements: false,
+        feeInfo: FIXED_BITCOIN_FEE_INFO,
+        selectionMode: 'columnar',
+      })],
+      {
+        selectionState: testSelectionState(
+          utxos.slice(2), FIXED_DESCRIPTOR_VSIZE),
+      },
+      emptyFunc,
+      clearUtxos,
+      (jsonString) => {
+        const {selectionState} = JSON.parse(jsonString);
+        return {selectionState};
+      },
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxos columnar 1.5[0.1, 0.2, 0.3, 0.4, 0.5]coins, req: 1.2 coins',
+      SelectUtxos,
+      [JSON.stringify({
+        utxos,
+        targetAmount: (1.2 * COIN_BASE),
+        isElements: false,
+        feeInfo: USE_FEE_BITCOIN_FEE_INFO,
+        selectionMode: 'columnar',
+      })],
+      {amount: ( 1.3 * COIN_BASE), coinNum: 4, feeAmount: 10280, utxoFeeAmount: 7280},
+      emptyFunc,
+      clearUtxos,
+      convertFunc,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxos columnar parallel bnb, req: 1.2 coins',
+      SelectUtxos,
+      [JSON.stringify({
+        utxos,
+        targetAmount: (1.2 * COIN_BASE),
+        isElements: false,
+        feeInfo: USE_FEE_BITCOIN_FEE_INFO,
+        selectionMode: 'columnar',
+        bnbOption: {
+          timeBudget: 1000,
+          threadCount: 4,
+        },
+      })],
+      {
+        amount: ( 1.3 * COIN_BASE), coinNum: 4, feeAmount: 10280, utxoFeeAmount: 7280,
+        bnbStatistics: {
+          isSelected: false, threadCount: 4, subtreeCount: 32, isTimeout: false, isCompleted: true,
+        },
+      },
+      emptyFunc,
+      clearUtxos,
+      convertBnbFunc,
+    );
+  })(),
+  // 0.5 and 0.3 coins match the target exactly (effective value).
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxos columnar parallel bnb exact match, req: 0.79993360 coins',
+      SelectUtxos,
+      [JSON.stringify({
+        utxos,
+        targetAmount: 79993360,
+        isElements: false,
+        feeInfo: USE_FEE_BITCOIN_FEE_INFO,
+        selectionMode: 'columnar',
+        bnbOption: {
+          timeBudget: 1000,
+          threadCount: 4,
+        },
+      })],
+      {
+        amount: (0.8 * COIN_BASE), coinNum: 2, feeAmount: 6640, utxoFeeAmount: 3640,
+        bnbStatistics: {
+          isSelected: true, threadCount: 4, subtreeCount: 32, isTimeout: false, isCompleted: true,
+        },
+      },
+      emptyFunc,
+      clearUtxos,
+      convertBnbFunc,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([1]).map(({txid, vout, amount}) => (
+      {txid, vout, amount}));
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxos columnar no descriptor, req: 0.5 coins',
+      SelectUtxos,
+      [JSON.stringify({
+        utxos,
+        targetAmount: (0.5 * COIN_BASE),
+        isElements: false,
+        feeInfo: USE_FEE_BITCOIN_FEE_INFO,
+        selectionMode: 'columnar',
+      })],
+      {amount: COIN_BASE, coinNum: 1, feeAmount: 4360, utxoFeeAmount: 1360},
+      emptyFunc,
+      clearUtxos,
+      convertFunc,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([1]).map(({txid, vout, amount}) => ({
+      txid, vout, amount,
+      descriptor: 'addr(bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4)',
+    }));
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxos columnar addr descriptor, req: 0.5 coins',
+      SelectUtxos,
+      [JSON.stringify({
+        utxos,
+        targetAmount: (0.5 * COIN_BASE),
+        isElements: false,
+        feeInfo: USE_FEE_BITCOIN_FEE_INFO,
+        selectionMode: 'columnar',
+      })],
+      {amount: COIN_BASE, coinNum: 1, feeAmount: 4360, utxoFeeAmount: 1360},
+      emptyFunc,
+      clearUtxos,
+      convertFunc,
+    );
+  })(),
+];
+
+const batchTestCase = [
+  (() => {
+    const utxos = testUtxos([1, 2, 5, 10, 20]);
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxosBatch 38[1,2,5,10,20]coins, req: [4, 12] coins',
+      SelectUtxosBatch,
+      [JSON.stringify({
+        utxos,
+        payouts: [
+          {targetAmount: (4 * COIN_BASE)},
+          {targetAmount: (12 * COIN_BASE)},
+        ],
+        isElements: false,
+        feeInfo: FIXED_BITCOIN_FEE_INFO,
+      })],
+      {
+        payouts: [
+          {amount: (5 * COIN_BASE), coinNum: 1, feeAmount: 1000},
+          {amount: (13 * COIN_BASE), coinNum: 3, feeAmount: 1000},
+        ],
+        totalFeeAmount: 2000,
+      },
+      emptyFunc,
+      clearUtxos,
+      convertBatchFunc,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([1, 2, 5]);
+    return TestHelper.createBitcoinTestCase(
+      'SelectUtxosBatch Error - 8[1,2,5]coins, req: [5, 5] coins',
+      SelectUtxosBatch,
+      [JSON.stringify({
+        utxos,
+        payouts: [
+          {targetAmount: (5 * COIN_BASE)},
+          {targetAmount: (5 * COIN_BASE)},
+        ],
+        isElements: false,
+        feeInfo: FIXED_BITCOIN_FEE_INFO,
+      })],
+      '{"error":{"code":2,"type":"illegal_state","message":"Failed to select coin. Not enough utxos."}}',
+    );
+  })(),
+];
+
+const BUMP_FEE_BITCOIN_FEE_INFO = {
+  txFeeAmount: 6000,
+  feeRate: 40,
+  longTermFeeRate: 20,
+};
+
+const reselectTestCase = [
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'ReselectUtxos previous[0.3, 0.4, 0.5]coins, req: 1.2 coins',
+      ReselectUtxos,
+      [JSON.stringify({
+        utxos,
+        previousUtxos: utxos.slice(2),
+        targetAmount: (1.2 * COIN_BASE),
+        isElements: false,
+        feeInfo: BUMP_FEE_BITCOIN_FEE_INFO,
+      })],
+      {
+        amount: (1.3 * COIN_BASE), coinNum: 4, feeAmount: 20560,
+        utxoFeeAmount: 14560, addedNum: 1, isFullSearch: false,
+      },
+      emptyFunc,
+      clearUtxos,
+      convertReselectFunc,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'ReselectUtxos previous[0.2, 0.3, 0.4, 0.5]coins, req: 1.2 coins',
+      ReselectUtxos,
+      [JSON.stringify({
+        utxos,
+        previousUtxos: utxos.slice(1),
+        targetAmount: (1.2 * COIN_BASE),
+        isElements: false,
+        feeInfo: BUMP_FEE_BITCOIN_FEE_INFO,
+      })],
+      {
+        amount: (1.4 * COIN_BASE), coinNum: 4, feeAmount: 20560,
+        utxoFeeAmount: 14560, addedNum: 0, isFullSearch: false,
+      },
+      emptyFunc,
+      clearUtxos,
+      convertReselectFunc,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'ReselectUtxos selectionState previous[0.3, 0.4, 0.5]coins, req: 1.2 coins',
+      ReselectUtxos,
+      [JSON.stringify({
+        utxos,
+        previousUtxos: utxos.slice(2),
+        selectionState: testSelectionState(
+          utxos.slice(2), FIXED_DESCRIPTOR_VSIZE),
+        targetAmount: (1.2 * COIN_BASE),
+        isElements: false,
+        feeInfo: BUMP_FEE_BITCOIN_FEE_INFO,
+      })],
+      {
+        amount: (1.3 * COIN_BASE), coinNum: 4, feeAmount: 20560,
+        utxoFeeAmount: 14560, addedNum: 1, isFullSearch: false,
+      },
+      emptyFunc,
+      clearUtxos,
+      convertReselectFunc,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'ReselectUtxos changeless selectionState previous[0.3, 0.4, 0.5]coins, req: 1.2 coins',
+      ReselectUtxos,
+      [JSON.stringify({
+        utxos,
+        previousUtxos: utxos.slice(2),
+        selectionState: testSelectionState(
+          utxos.slice(2), FIXED_DESCRIPTOR_VSIZE, true),
+        targetAmount: (1.2 * COIN_BASE),
+        isElements: false,
+        feeInfo: BUMP_FEE_BITCOIN_FEE_INFO,
+      })],
+      {
+        amount: (1.3 * COIN_BASE), coinNum: 4, feeAmount: 20560,
+        utxoFeeAmount: 14560, addedNum: 1, isFullSearch: false,
+        selectionState: testSelectionState(
+          utxos.slice(2).concat(utxos.slice(0, 1)), FIXED_DESCRIPTOR_VSIZE),
+      },
+      emptyFunc,
+      clearUtxos,
+      (jsonString) => {
+        const {selectionState} = JSON.parse(jsonString);
+        return Object.assign(
+          convertReselectFunc(jsonString), {selectionState});
+      },
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'ReselectUtxos Error - selectionState of other utxos',
+      ReselectUtxos,
+      [JSON.stringify({
+        utxos,
+        previousUtxos: utxos.slice(2),
+        selectionState: testSelectionState(
+          utxos.slice(1), FIXED_DESCRIPTOR_VSIZE),
+        targetAmount: (1.2 * COIN_BASE),
+        isElements: false,
+        feeInfo: BUMP_FEE_BITCOIN_FEE_INFO,
+      })],
+      '{"error":{"code":1,"type":"illegal_argument","message":"Failed to ReselectUtxos. selectionState does not match previousUtxos."}}',
+      emptyFunc,
+      clearUtxos,
+    );
+  })(),
+  (() => {
+    const utxos = testUtxos([0.1, 0.2, 0.3, 0.4, 0.5]);
+    return TestHelper.createBitcoinTestCase(
+      'ReselectUtxos Error - selectionState of unknown version',
+      ReselectUtxos,
+      [JSON.stringify({
+        utxos,
+        previousUtxos: utxos.slice(2),
+        selectionState: '02' + testSelectionState(
+          utxos.slice(2), FIXED_DESCRIPTOR_VSIZE).slice(2),
+        targetAmount: (1.2 * COIN_BASE),
+        isElements: false,
+        feeInfo: BUMP_FEE_BITCOIN_FEE_INFO,
+      })],
+      '{"error":{"code":1,"type":"illegal_argument","message":"Failed to ReselectUtxos. selectionState is invalid."}}',
+      emptyFunc,
+      clearUtxos,
+    );
+  })(),
 ];
 
 const errorCase = [
@@ -454,6 +838,37 @@ const elementsTestCase = [
       convertFunc,
     );
   })(),
+  (() => {
+    const utxoA = testUtxos([1, 2, 5, 10, 20], ASSET_ID_A);
+    const utxoB = testUtxos([3, 7, 8], ASSET_ID_B);
+    const utxoC = testUtxos([4, 6, 9], ASSET_ID_C);
+    const utxos = utxoA.concat(utxoB, utxoC);
+    return TestHelper.createElementsTestCase(
+      'SelectUtxos - Elements - columnar parallel asset selection',
+      SelectUtxos,
+      [JSON.stringify({
+        utxos,
+        targets: [{
+          asset: ASSET_ID_A,
+          amount: (37 * COIN_BASE),
+        }, {
+          asset: ASSET_ID_B,
+          amount: (10 * COIN_BASE),
+        }, {
+          asset: ASSET_ID_C,
+          amount: (15 * COIN_BASE),
+        }],
+        isElements: true,
+        feeInfo: UNUSE_FEE_ELEMENTS_FEE_INFO,
+        selectionMode: 'columnar',
+        parallelAssetSelection: true,
+      })],
+      {amount: (62 * COIN_BASE), coinNum: 8},
+      emptyFunc,
+      clearUtxos,
+      convertFunc,
+    );
+  })(),
 ];
 
 const elementsErrorCase = [
@@ -612,6 +1027,8 @@ const elementsErrorCase = [
 
 TestHelper.doTest('SelectUtxos', testCase);
 TestHelper.doTest('SelectUtxos ErrorCase', errorCase);
+TestHelper.doTest('SelectUtxosBatch', batchTestCase);
+TestHelper.doTest('ReselectUtxos', reselectTestCase);
 
 TestHelper.doTest('SelectUtxos - Elements', elementsTestCase);
 TestHelper.doTest('SelectUtxos ErrorCase - Elements', elementsErrorCase);
@@ -1,5 +1,14 @@
 const TestHelper = require('./JsonTestHelper');
 
+const getLockingScriptCacheCount = async (helper, cfd,
+    base = {hitCount: 0, missCount: 0}) => {
+  const info = await helper.getResponse(cfd.GetLockingScriptCacheInfo());
+  return {
+    hitCount: info.hitCount - base.hitCount,
+    missCount: info.missCount - base.missCount,
+  };
+};
+
 const createTestFunc = (helper) => {
   // eslint-disable-next-line @typescript-eslint/no-unused-vars
   return async (cfd, testName, req, isError) => {
@@ -18,6 +27,13 @@ const createTestFunc = (helper) => {
       resp = cfd.ElementsDecodeRawTransaction(request);
       resp = await helper.getResponse(resp);
       break;
+    case 'ConfidentialTransaction.DecodeCache':
+      resp = cfd.ElementsDecodeRawTransaction(request);
+      resp = await helper.getResponse(resp);
+      resp = await getLockingScriptCacheCount(helper, cfd);
+      await helper.getResponse(cfd.ElementsDecodeRawTransaction(request));
+      resp = await getLockingScriptCacheCount(helper, cfd, resp);
+      break;
     case 'ConfidentialTransaction.CreateSighash':
       resp = cfd.CreateElementsSignatureHash(request);
       resp = await helper.getResponse(resp);
@@ -114,6 +130,10 @@ const createTestFunc = (helper) => {
       resp = cfd.GetDefaultBlindingKey(request);
       resp = await helper.getResponse(resp);
       break;
+    case 'ConfidentialTransaction.BlindingKey.DefaultBatch':
+      resp = cfd.GetDefaultBlindingKeyBatch(request);
+      resp = await helper.getResponse(resp);
+      break;
     case 'ConfidentialTransaction.BlindingKey.Issuance':
       resp = cfd.GetIssuanceBlindingKey(request);
       resp = await helper.getResponse(resp);
@@ -122,6 +142,10 @@ const createTestFunc = (helper) => {
       resp = cfd.CreateRawPegin(request);
       resp = await helper.getResponse(resp);
       break;
+    case 'ConfidentialTransaction.CreateRawPeginBatch':
+      resp = cfd.CreateRawPeginBatch(request);
+      resp = await helper.getResponse(resp);
+      break;
     case 'ConfidentialTransaction.CreateRawPegout':
       resp = cfd.CreateRawPegout(request);
       resp = await helper.getResponse(resp);
@@ -142,10 +166,22 @@ const createTestFunc = (helper) => {
       resp = cfd.SetRawReissueAsset(request);
       resp = await helper.getResponse(resp);
       break;
+    case 'ConfidentialTransaction.SetIssuanceBatch':
+      resp = cfd.SetRawIssuanceBatch(request);
+      resp = await helper.getResponse(resp);
+      break;
     case 'ConfidentialTransaction.Blind':
       resp = cfd.BlindRawTransaction(request);
       resp = await helper.getResponse(resp);
       break;
+    case 'ConfidentialTransaction.ScanAndUnblind':
+      resp = cfd.ScanAndUnblind(request);
+      resp = await helper.getResponse(resp);
+      break;
+    case 'ConfidentialTransaction.EstimateBlindProofSize':
+      resp = cfd.EstimateBlindProofSize(request);
+      resp = await helper.getResponse(resp);
+      break;
     default:
       throw new Error('unknown name: ' + testName);
     }
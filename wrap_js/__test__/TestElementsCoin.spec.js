@@ -1,10 +1,35 @@
 const TestHelper = require('./JsonTestHelper');
 
+// Call the api with the request utxos registered to a utxo pool.
+// poolOption: true, or {remove: [outpoint], lock: [outpoint]}
+const callOnUtxoPool = async (helper, cfd, apiFunc, request, poolOption) => {
+  const pool = await helper.getResponse(
+    cfd.CreateUtxoPool({isElements: true}));
+  try {
+    await helper.getResponse(cfd.AddUtxoPoolItems(
+      {poolId: pool.poolId, utxos: request.utxos}));
+    if (poolOption.remove) {
+      await helper.getResponse(cfd.RemoveUtxoPoolItems(
+        {poolId: pool.poolId, outpoints: poolOption.remove}));
+    }
+    if (poolOption.lock) {
+      await helper.getResponse(cfd.LockUtxoPoolItems(
+        {poolId: pool.poolId, outpoints: poolOption.lock}));
+    }
+    const poolRequest = {...request, utxoPoolId: pool.poolId};
+    delete poolRequest.utxos;
+    return await helper.getResponse(apiFunc(poolRequest));
+  } finally {
+    await helper.getResponse(cfd.DeleteUtxoPool({poolId: pool.poolId}));
+  }
+};
+
 const createTestFunc = (helper) => {
   // eslint-disable-next-line @typescript-eslint/no-unused-vars
   return async (cfd, testName, req, isError) => {
     let resp;
-    const request = {isElements: true, ...req};
+    const {utxoPool, ...reqData} = req;
+    const request = {isElements: true, ...reqData};
     const utxos = [];
     if ('utxoFile' in req) {
       const getUtxos = require(`./data/utxo/${req.utxoFile}`);
@@ -15,6 +40,11 @@ const createTestFunc = (helper) => {
     }
     switch (testName) {
     case 'Elements.CoinSelection':
+      if (utxoPool) {
+        resp = await callOnUtxoPool(
+          helper, cfd, (r) => cfd.SelectUtxos(r), request, utxoPool);
+        break;
+      }
       resp = cfd.SelectUtxos(request);
       resp = await helper.getResponse(resp);
       break;
@@ -23,6 +53,11 @@ const createTestFunc = (helper) => {
       resp = await helper.getResponse(resp);
       break;
     case 'Elements.FundTransaction':
+      if (utxoPool) {
+        resp = await callOnUtxoPool(
+          helper, cfd, (r) => cfd.FundRawTransaction(r), request, utxoPool);
+        break;
+      }
       resp = cfd.FundRawTransaction(request);
       resp = await helper.getResponse(resp);
       break;
@@ -9,6 +9,10 @@ const createTestFunc = (helper) => {
       resp = cfd.GetCommitment(req);
       resp = await helper.getResponse(resp);
       break;
+    case 'Elements.GetCommitments':
+      resp = cfd.GetCommitments(req);
+      resp = await helper.getResponse(resp);
+      break;
     case 'Elements.UnblindData':
       resp = cfd.GetUnblindData(req);
       resp = await helper.getResponse(resp);
@@ -30,6 +34,7 @@ const createCheckFunc = (helper) => {
     }
     if (exp.assetCommitment) expect(resp.assetCommitment).toEqual(exp.assetCommitment);
     if (exp.amountCommitment) expect(resp.amountCommitment).toEqual(exp.amountCommitment);
+    if (exp.commitments) expect(resp.commitments).toEqual(exp.commitments);
     if (exp.asset) expect(resp.asset).toEqual(exp.asset);
     if (exp.blindFactor) expect(resp.blindFactor).toEqual(exp.blindFactor);
     if (exp.assetBlindFactor) expect(resp.assetBlindFactor).toEqual(exp.assetBlindFactor);
@@ -38,6 +38,14 @@ const createTestFunc = (helper) => {
       resp = cfd.SignPsbt(request);
       resp = await helper.getResponse(resp);
       break;
+    case 'Psbt.SignPsbtByXprv':
+      resp = cfd.SignPsbt({psbt: request.psbt, privkeys: request.privkeys});
+      resp = await helper.getResponse(resp);
+      resp = {
+        isMatch: (resp.psbt === (await helper.getResponse(cfd.SignPsbt(
+            {psbt: request.psbt, xprv: request.xprv}))).psbt),
+      };
+      break;
     case 'Psbt.VerifyPsbtSign':
       resp = cfd.VerifyPsbtSign(request);
       resp = await helper.getResponse(resp);
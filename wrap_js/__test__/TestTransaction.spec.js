@@ -26,6 +26,10 @@ const createTestFunc = (helper) => {
       resp = cfd.GetSighash(request);
       resp = await helper.getResponse(resp);
       break;
+    case 'Transaction.GetSighashes':
+      resp = cfd.GetSighashes(request);
+      resp = await helper.getResponse(resp);
+      break;
     case 'Transaction.SignWithPrivkey':
       resp = cfd.SignWithPrivkey(request);
       resp = await helper.getResponse(resp);
@@ -50,6 +54,14 @@ const createTestFunc = (helper) => {
       resp = cfd.SplitTxOut(request);
       resp = await helper.getResponse(resp);
       break;
+    case 'Transaction.EditRawTransaction':
+      resp = cfd.EditRawTransaction(request);
+      resp = await helper.getResponse(resp);
+      break;
+    case 'Transaction.EstimateTransactionSize':
+      resp = cfd.EstimateTransactionSize(request);
+      resp = await helper.getResponse(resp);
+      break;
     case 'Transaction.GetTxInIndex':
       resp = cfd.GetTxInIndex(request);
       resp = await helper.getResponse(resp);